@@ -2,10 +2,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath>
 #include <cstdlib>
+#include <functional>
 #include <iterator>
 #include <list>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <set>
@@ -20,6 +23,7 @@
 #include "avatar_action.h"
 #include "calendar.h"
 #include "character.h"
+#include "character_id.h"
 #include "clzones.h"
 #include "colony.h"
 #include "construction.h"
@@ -2133,6 +2137,31 @@ static bool chop_plank_activity( player &p, const tripoint &src_loc )
     return false;
 }
 
+/** Adds the real time spent until it goes out of scope to a character's loot sorting stats */
+class loot_sort_timer
+{
+    public:
+        loot_sort_timer( zone_manager &mgr, const character_id &who ) : mgr( mgr ), who( who ),
+            start( std::chrono::steady_clock::now() ) {}
+        ~loot_sort_timer() {
+            if( !stopped ) {
+                mgr.loot_sort_stats( who ).time += elapsed();
+            }
+        }
+        std::chrono::steady_clock::duration elapsed() const {
+            return std::chrono::steady_clock::now() - start;
+        }
+        /** Don't add the time, the stats are being cleared */
+        void stop() {
+            stopped = true;
+        }
+    private:
+        zone_manager &mgr;
+        character_id who;
+        std::chrono::steady_clock::time_point start;
+        bool stopped = false;
+};
+
 void activity_on_turn_move_loot( player_activity &act, player &p )
 {
     enum activity_stage : int {
@@ -2145,17 +2174,19 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
     };
 
     int &stage = act.index;
+    auto &mgr = zone_manager::get_manager();
     //Prepare activity stage
     if( stage < 0 ) {
         stage = INIT;
         //num_processed
         act.values.push_back( 0 );
+        mgr.clear_loot_sort_stats( p.getID() );
     }
     int &num_processed = act.values[ 0 ];
+    loot_sort_timer timer( mgr, p.getID() );
 
     map &here = get_map();
     const auto abspos = here.getabs( p.pos() );
-    auto &mgr = zone_manager::get_manager();
     if( here.check_vehicle_zones( g->get_levz() ) ) {
         mgr.cache_vzones();
     }
@@ -2323,8 +2354,9 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
             vehicle *this_veh = it->second ? src_veh : nullptr;
             const int this_part = it->second ? src_part : -1;
 
-            const zone_type_id id = mgr.get_near_zone_type_for_item( thisitem, abspos,
-                                    ACTIVITY_SEARCH_DISTANCE );
+            const loot_destinations &destinations = mgr.get_loot_destinations( abspos,
+                    ACTIVITY_SEARCH_DISTANCE );
+            const zone_type_id id = destinations.zone_type_for( thisitem );
 
             // checks whether the item is already on correct loot zone or not
             // if it is, we can skip such item, if not we move the item to correct pile
@@ -2333,9 +2365,7 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
                 continue;
             }
 
-            const std::unordered_set<tripoint> &dest_set = mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE,
-                    &thisitem );
-            for( const tripoint &dest : dest_set ) {
+            for( const tripoint &dest : destinations.tiles_for( id, thisitem ) ) {
                 const tripoint &dest_loc = here.getlocal( dest );
 
                 //Check destination for cargo part
@@ -2364,6 +2394,7 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
                 // check free space at destination
                 if( free_space >= thisitem.volume() ) {
                     move_item( p, thisitem, thisitem.count(), src_loc, dest_loc, this_veh, this_part );
+                    mgr.loot_sort_stats( p.getID() ).moved++;
 
                     // moved item away from source so decrement
                     if( num_processed > 0 ) {
@@ -2384,6 +2415,12 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
 
     // If we got here without restarting the activity, it means we're done
     add_msg( m_info, _( "%s sorted out every item possible." ), p.disp_name( false, true ) );
+    const zone_manager::loot_sort_stats_t &stats = mgr.loot_sort_stats( p.getID() );
+    const double seconds = std::chrono::duration<double>( stats.time + timer.elapsed() ).count();
+    DebugLog( DL::Info, DC::Game ) << p.disp_name() << " sorted " << stats.moved << " items in " <<
+                                   seconds << " s (" << ( seconds > 0 ? stats.moved / seconds : 0 ) << " items/s)";
+    timer.stop();
+    mgr.clear_loot_sort_stats( p.getID() );
     if( p.is_npc() ) {
         npc *guy = dynamic_cast<npc *>( &p );
         guy->revert_after_activity();
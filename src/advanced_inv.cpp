@@ -346,9 +346,9 @@ void advanced_inventory::print_items( const advanced_inventory_pane &pane, bool
             }
         } else {
             if( stolen ) {
-                item_name = string_format( "%s %s", stolen_string, it.display_name() );
+                item_name = string_format( "%s %s", stolen_string, sitem.display_name );
             } else {
-                item_name = it.display_name();
+                item_name = sitem.display_name;
             }
         }
         if( get_option<bool>( "ITEM_SYMBOLS" ) ) {
@@ -559,6 +559,10 @@ int advanced_inventory::print_header( advanced_inventory_pane &pane, aim_locatio
 void advanced_inventory::recalc_pane( side p )
 {
     auto &pane = panes[p];
+    if( recalc ) {
+        // Items were moved or changed, possibly in ways the revisions don't show
+        pane.forget_listings();
+    }
     pane.recalc = false;
     pane.items.clear();
     // Add items from the source location or in case of all 9 surrounding squares,
@@ -1477,7 +1481,7 @@ void advanced_inventory::display()
             recalc = true;
         } else if( action == "SORT" ) {
             if( show_sort_menu( spane ) ) {
-                recalc = true;
+                spane.recalc = true;
             }
         } else if( action == "FILTER" ) {
             std::string filter = spane.filter;
@@ -429,11 +429,11 @@ advanced_inv_area::itemstack advanced_inv_area::i_stacked( T items )
     advanced_inv_area::itemstack stacks;
     //    // make a list of the items first, so we can add non stacked items back on
     //    std::list<item> items(things.begin(), things.end());
-    // used to recall indices we stored `itype_id' item at in itemstack
-    std::unordered_map<itype_id, std::set<int>> cache;
+    // used to recall indices we stored items with a given stacking hash at in itemstack
+    std::unordered_map<size_t, std::set<int>> cache;
     // iterate through and create stacks
     for( auto &elem : items ) {
-        const auto id = elem.typeId();
+        const size_t id = elem.stacking_hash();
         auto iter = cache.find( id );
         bool got_stacked = false;
         // cache entry exists
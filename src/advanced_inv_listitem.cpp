@@ -12,6 +12,7 @@ advanced_inv_listitem::advanced_inv_listitem( item *an_item, int index, int coun
     , id( an_item->typeId() )
     , name( an_item->tname( count ) )
     , name_without_prefix( an_item->tname( 1, false ) )
+    , display_name( an_item->display_name() )
     , autopickup( get_auto_pickup().has_rule( an_item ) )
     , stacks( count )
     , volume( an_item->volume() * stacks )
@@ -31,6 +32,7 @@ advanced_inv_listitem::advanced_inv_listitem( const std::list<item *> &list, int
     items( list ),
     name( list.front()->tname( list.size() ) ),
     name_without_prefix( list.front()->tname( 1, false ) ),
+    display_name( list.front()->display_name() ),
     autopickup( get_auto_pickup().has_rule( list.front() ) ),
     stacks( list.size() ),
     volume( list.front()->volume() * stacks ),
@@ -42,6 +42,10 @@ class advanced_inv_listitem
          * Name of the item (singular) without damage (or similar) prefix, used for sorting.
          */
         std::string name_without_prefix;
+        /**
+         * Name shown in the pane, generated with the list rather than on every redraw.
+         */
+        std::string display_name;
         /**
          * Whether auto pickup is enabled for this item (based on the name).
          */
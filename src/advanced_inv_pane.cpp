@@ -80,19 +80,20 @@ bool advanced_inventory_pane::is_filtered( const item &it ) const
     return !filtercache[str]( it );
 }
 
-void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
-        bool vehicle_override )
+const std::vector<advanced_inv_listitem> &advanced_inventory_pane::listing_of(
+    advanced_inv_area &square, bool in_vehicle )
 {
-    assert( square.id != AIM_ALL );
-    square.volume = 0_ml;
-    square.weight = 0_gram;
-    if( !square.canputitems() ) {
-        return;
-    }
     map &m = get_map();
     avatar &u = get_avatar();
-    // Existing items are *not* cleared on purpose, this might be called
-    // several times in case all surrounding squares are to be shown.
+    area_listing &listing = listings[std::make_pair( square.id, in_vehicle )];
+    const auto key = std::make_tuple( square.pos, square.veh, square.vstor,
+                                      m.get_contents_revision(), u.inv.get_revision(), u.worn.size(),
+                                      calendar::turn );
+    if( listing.key == key && !listing.items.empty() ) {
+        return listing.items;
+    }
+    listing.key = key;
+    listing.items.clear();
     if( square.id == AIM_INVENTORY ) {
         const invslice &stacks = u.inv.slice();
         for( size_t x = 0; x < stacks.size(); ++x ) {
@@ -100,26 +101,37 @@ void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
             for( item &i : *stacks[x] ) {
                 item_pointers.push_back( &i );
             }
-            advanced_inv_listitem it( item_pointers, x, square.id, false );
-            if( is_filtered( *it.items.front() ) ) {
-                continue;
-            }
-            square.volume += it.volume;
-            square.weight += it.weight;
-            items.push_back( it );
+            listing.items.emplace_back( item_pointers, x, square.id, false );
         }
     } else if( square.id == AIM_WORN ) {
         auto iter = u.worn.begin();
         for( size_t i = 0; i < u.worn.size(); ++i, ++iter ) {
-            advanced_inv_listitem it( &*iter, i, 1, square.id, false );
-            if( is_filtered( *it.items.front() ) ) {
-                continue;
-            }
-            square.volume += it.volume;
-            square.weight += it.weight;
-            items.push_back( it );
+            listing.items.emplace_back( &*iter, i, 1, square.id, false );
+        }
+    } else {
+        const advanced_inv_area::itemstack &stacks = in_vehicle ?
+                square.i_stacked( square.veh->get_items( square.vstor ) ) :
+                square.i_stacked( m.i_at( square.pos ) );
+
+        for( size_t x = 0; x < stacks.size(); ++x ) {
+            listing.items.emplace_back( stacks[x], x, square.id, in_vehicle );
         }
-    } else if( square.id == AIM_CONTAINER ) {
+    }
+    return listing.items;
+}
+
+void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
+        bool vehicle_override )
+{
+    assert( square.id != AIM_ALL );
+    square.volume = 0_ml;
+    square.weight = 0_gram;
+    if( !square.canputitems() ) {
+        return;
+    }
+    // Existing items are *not* cleared on purpose, this might be called
+    // several times in case all surrounding squares are to be shown.
+    if( square.id == AIM_CONTAINER ) {
         item *cont = square.get_container( in_vehicle() );
         if( cont != nullptr ) {
             if( !cont->is_container_empty() ) {
@@ -132,21 +144,16 @@ void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
             }
             square.desc[0] = cont->tname( 1, false );
         }
-    } else {
-        bool is_in_vehicle = square.can_store_in_vehicle() && ( in_vehicle() || vehicle_override );
-        const advanced_inv_area::itemstack &stacks = is_in_vehicle ?
-                square.i_stacked( square.veh->get_items( square.vstor ) ) :
-                square.i_stacked( m.i_at( square.pos ) );
-
-        for( size_t x = 0; x < stacks.size(); ++x ) {
-            advanced_inv_listitem it( stacks[x], x, square.id, is_in_vehicle );
-            if( is_filtered( *it.items.front() ) ) {
-                continue;
-            }
-            square.volume += it.volume;
-            square.weight += it.weight;
-            items.push_back( it );
+        return;
+    }
+    const bool is_in_vehicle = square.can_store_in_vehicle() && ( in_vehicle() || vehicle_override );
+    for( const advanced_inv_listitem &it : listing_of( square, is_in_vehicle ) ) {
+        if( is_filtered( *it.items.front() ) ) {
+            continue;
         }
+        square.volume += it.volume;
+        square.weight += it.weight;
+        items.push_back( it );
     }
 }
 
@@ -7,13 +7,18 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "advanced_inv_area.h"
 #include "advanced_inv_listitem.h"
+#include "calendar.h"
 #include "cursesdef.h"
+#include "point.h"
 
 class item;
+class vehicle;
 struct advanced_inv_pane_save_state;
 
 enum aim_location : char;
@@ -84,6 +89,13 @@ class advanced_inventory_pane
         bool recalc = false;
 
         void add_items_from_area( advanced_inv_area &square, bool vehicle_override = false );
+        /**
+         * Drops the saved listings of the areas, for changes to their items that the map and
+         * inventory revisions don't track (e.g. toggling favorites).
+         */
+        void forget_listings() {
+            listings.clear();
+        }
         /**
          * Makes sure the @ref index is valid (if possible).
          */
@@ -127,5 +139,18 @@ class advanced_inventory_pane
         void mod_index( int offset );
 
         mutable std::map<std::string, std::function<bool( const item & )>> filtercache;
+
+        /**
+         * Unfiltered entries of an area, kept while the revisions of its items stay the same,
+         * so that changing the filter or switching areas doesn't restack and rename them.
+         */
+        struct area_listing {
+            std::tuple<tripoint, const vehicle *, int, int, int, size_t, time_point> key;
+            std::vector<advanced_inv_listitem> items;
+        };
+        /** Listings by area and whether they show vehicle cargo */
+        std::map<std::pair<aim_location, bool>, area_listing> listings;
+        const std::vector<advanced_inv_listitem> &listing_of( advanced_inv_area &square,
+                bool in_vehicle );
 };
 #endif // CATA_SRC_ADVANCED_INV_PANE_H
@@ -332,6 +332,7 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     tileset_loader loader( *new_tileset_ptr, renderer );
     loader.load( tileset_id, precheck );
     tileset_ptr = std::move( new_tileset_ptr );
+    clear_looks_like_cache();
 
     set_draw_scale( 16 );
 
@@ -340,6 +341,7 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
 
 void cata_tiles::reinit()
 {
+    clear_looks_like_cache();
     set_draw_scale( 16 );
     RenderClear( renderer );
 }
@@ -1691,6 +1693,31 @@ cata_tiles::find_tile_looks_like_by_string_id( const std::string &id, TILE_CATEG
     return find_tile_looks_like( obj.looks_like, category, looks_like_jumps_limit - 1 );
 }
 
+void cata_tiles::clear_looks_like_cache() const
+{
+    for( auto &cache : looks_like_cache ) {
+        cache.clear();
+    }
+}
+
+cata::optional<tile_lookup_res>
+cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category ) const
+{
+    const season_type season = season_of_year( calendar::turn );
+    if( season != looks_like_cache_season ) {
+        clear_looks_like_cache();
+        looks_like_cache_season = season;
+    }
+    auto &cache = looks_like_cache[category];
+    const auto iter = cache.find( id );
+    if( iter != cache.end() ) {
+        return iter->second;
+    }
+    const cata::optional<tile_lookup_res> res = find_tile_looks_like( id, category, 10 );
+    cache.emplace( id, res );
+    return res;
+}
+
 cata::optional<tile_lookup_res>
 cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
                                   const int looks_like_jumps_limit ) const
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_CATA_TILES_H
 #define CATA_SRC_CATA_TILES_H
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
@@ -358,9 +359,15 @@ class cata_tiles
 
         cata::optional<tile_lookup_res> find_tile_with_season( const std::string &id ) const;
 
+        /**
+         * Finds the tile for id, following looks_like up to looks_like_jumps_limit times.
+         * The overload without a limit memoizes its results, see @ref looks_like_cache.
+         */
+        cata::optional<tile_lookup_res>
+        find_tile_looks_like( const std::string &id, TILE_CATEGORY category ) const;
         cata::optional<tile_lookup_res>
         find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
-                              int looks_like_jumps_limit = 10 ) const;
+                              int looks_like_jumps_limit ) const;
 
         // this templated method is used only from it's own cpp file, so it's ok to declare it here
         template<typename T>
@@ -545,6 +552,12 @@ class cata_tiles
          */
         void reinit();
 
+        /**
+         * Forgets memoized tile lookups. Needed when game data changes, as looks_like
+         * chains depend on the loaded mods.
+         */
+        void clear_looks_like_cache() const;
+
         int get_tile_height() const {
             return tile_height;
         }
@@ -587,6 +600,13 @@ class cata_tiles
         const SDL_Renderer_Ptr &renderer;
         const GeometryRenderer_Ptr &geometry;
         std::unique_ptr<tileset> tileset_ptr;
+        /**
+         * Results of @ref find_tile_looks_like per category and id. Entries point into
+         * @ref tileset_ptr and depend on the season, so they are dropped whenever either changes.
+         */
+        mutable std::array<std::unordered_map<std::string, cata::optional<tile_lookup_res>>, C_OVERMAP_NOTE + 1>
+        looks_like_cache;
+        mutable season_type looks_like_cache_season = season_type::NUM_SEASONS;
 
         int tile_height = 0;
         int tile_width = 0;
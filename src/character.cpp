@@ -2726,7 +2726,37 @@ units::mass Character::weight_carried() const
 
 units::volume Character::volume_carried() const
 {
-    return inv.volume();
+    return get_carried_totals().inv_volume;
+}
+
+Character::carried_totals Character::calc_carried_totals() const
+{
+    carried_totals totals;
+    for( const item &i : worn ) {
+        totals.worn_weight += i.weight();
+    }
+    totals.inv_weight = inv.weight();
+    totals.inv_volume = inv.volume();
+    return totals;
+}
+
+const Character::carried_totals &Character::get_carried_totals() const
+{
+    const auto key = std::make_tuple( calendar::turn, moves, inv.get_revision(), worn.size() );
+    if( !carried_cache || carried_cache_key != key ) {
+        carried_cache = calc_carried_totals();
+        carried_cache_key = key;
+    }
+#if defined(CATA_CARRIED_CACHE_DEBUGGING)
+    const carried_totals fresh = calc_carried_totals();
+    if( fresh.worn_weight != carried_cache->worn_weight ||
+        fresh.inv_weight != carried_cache->inv_weight ||
+        fresh.inv_volume != carried_cache->inv_volume ) {
+        debugmsg( "stale carried weight/volume cache for %s", disp_name() );
+        carried_cache = fresh;
+    }
+#endif
+    return *carried_cache;
 }
 
 int Character::best_nearby_lifting_assist() const
@@ -2754,16 +2784,21 @@ units::mass Character::weight_carried_reduced_by( const excluded_stacks &without
 {
     const std::map<const item *, int> empty;
 
-    // Worn items
     units::mass ret = 0_gram;
-    for( auto &i : worn ) {
-        if( !without.count( &i ) ) {
-            ret += i.weight();
+    if( without.empty() ) {
+        const carried_totals &totals = get_carried_totals();
+        ret = totals.worn_weight + totals.inv_weight;
+    } else {
+        // Worn items
+        for( auto &i : worn ) {
+            if( !without.count( &i ) ) {
+                ret += i.weight();
+            }
         }
-    }
 
-    // Items in inventory
-    ret += inv.weight_without( without );
+        // Items in inventory
+        ret += inv.weight_without( without );
+    }
 
     // Wielded item
     units::mass weaponweight = 0_gram;
@@ -2801,7 +2836,7 @@ units::mass Character::weight_carried_reduced_by( const excluded_stacks &without
 units::volume Character::volume_carried_reduced_by( const excluded_stacks &without ) const
 {
     if( without.empty() ) {
-        return inv.volume();
+        return volume_carried();
     } else {
         return inv.volume_without( without );
     }
@@ -3645,6 +3680,7 @@ bool Character::has_nv()
 
 void Character::reset_encumbrance()
 {
+    carried_cache.reset();
     *encumbrance_cache = calc_encumbrance();
 }
 
@@ -14,6 +14,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -2076,6 +2077,23 @@ class Character : public Creature, public visitable<Character>
 
         trap_map known_traps;
         pimpl<char_encumbrance_data> encumbrance_cache;
+
+        /** Sums behind @ref weight_carried and @ref volume_carried */
+        struct carried_totals {
+            units::mass worn_weight = 0_gram;
+            units::mass inv_weight = 0_gram;
+            units::volume inv_volume = 0_ml;
+        };
+        carried_totals calc_carried_totals() const;
+        /**
+         * Returns the cached @ref carried_totals, recalculating them when the inventory, the
+         * worn items, the turn or the moves left have changed since. Items modified in place
+         * are only picked up once the action doing it spends moves.
+         */
+        const carried_totals &get_carried_totals() const;
+        mutable cata::optional<carried_totals> carried_cache;
+        /** Turn, moves, inventory revision and worn item count the cache was built for */
+        mutable std::tuple<time_point, int, int, size_t> carried_cache_key;
         mutable std::map<std::string, double> cached_info;
         bool bio_soporific_powered_at_last_sleep_check = false;
         /** last time we checked for sleep */
@@ -2200,7 +2218,22 @@ class Character : public Creature, public visitable<Character>
 
         int cached_moves = 0;
         tripoint cached_position;
+        int cached_radius = 0;
+        bool cached_clear_path = false;
+        int cached_map_revision = 0;
+        /**
+         * The map items form the lower layer of @ref cached_crafting_inventory, and the
+         * character's own items the upper one, so that spending moves only redoes the latter.
+         * The map layer holds copies made at the map contents and charges revisions below, and
+         * is kept across turns. Map items changed in place through references, without bumping
+         * a revision, are not seen until @ref invalidate_crafting_inventory is called.
+         */
         inventory cached_crafting_inventory;
+        tripoint cached_map_inventory_position = tripoint_min;
+        int cached_map_inventory_radius = 0;
+        bool cached_map_inventory_clear_path = false;
+        int cached_map_inventory_revision = 0;
+        int cached_map_inventory_charges_revision = 0;
 
     protected:
         // a cache of all active enchantment values.
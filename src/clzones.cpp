@@ -601,8 +601,16 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
     return type_iter != area_cache.end();
 }
 
+void zone_manager::bump_cache_revision()
+{
+    // Shared by all managers, so that a reset manager never repeats an older revision
+    static int last_revision = 0;
+    cache_revision = ++last_revision;
+}
+
 void zone_manager::cache_data()
 {
+    bump_cache_revision();
     area_cache.clear();
 
     for( auto &elem : zones ) {
@@ -623,6 +631,7 @@ void zone_manager::cache_data()
 
 void zone_manager::cache_vzones()
 {
+    bump_cache_revision();
     vzone_cache.clear();
     auto vzones = get_map().get_vehicle_zones( g->get_levz() );
     for( auto elem : vzones ) {
@@ -643,12 +652,18 @@ void zone_manager::cache_vzones()
     }
 }
 
-std::unordered_set<tripoint> zone_manager::get_point_set( const zone_type_id &type,
+static const std::unordered_set<tripoint> &no_points()
+{
+    static const std::unordered_set<tripoint> empty;
+    return empty;
+}
+
+const std::unordered_set<tripoint> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return no_points();
     }
 
     return type_iter->second;
@@ -679,13 +694,13 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &w
     return res;
 }
 
-std::unordered_set<tripoint> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return no_points();
     }
 
     return type_iter->second;
@@ -778,13 +793,7 @@ std::unordered_set<tripoint> zone_manager::get_near( const zone_type_id &type,
     for( auto &point : point_set ) {
         if( point.z == where.z ) {
             if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_LOOT_CUSTOM, point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
-                    near_point_set.insert( point );
-                }
+                near_point_set.insert( point );
             }
         }
     }
@@ -793,17 +802,18 @@ std::unordered_set<tripoint> zone_manager::get_near( const zone_type_id &type,
     for( auto &point : vzone_set ) {
         if( point.z == where.z ) {
             if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_LOOT_CUSTOM, point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
-                    near_point_set.insert( point );
-                }
+                near_point_set.insert( point );
             }
         }
     }
 
+    // Filtered only now: looking up the custom zone may rebuild the vehicle zone cache
+    if( it ) {
+        erase_if( near_point_set, [&]( const tripoint & point ) {
+            return has( zone_LOOT_CUSTOM, point ) && !custom_loot_has( point, it );
+        } );
+    }
+
     return near_point_set;
 }
 
@@ -847,27 +857,35 @@ cata::optional<tripoint> zone_manager::get_nearest( const zone_type_id &type, co
 
 zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
         const tripoint &where, int range ) const
+{
+    const bool custom_accepts = has_near( zone_LOOT_CUSTOM, where, range ) &&
+                                !get_near( zone_LOOT_CUSTOM, where, range, &it ).empty();
+    return zone_type_for_item( it, custom_accepts, [&]( const zone_type_id & type ) {
+        return has_near( type, where, range );
+    } );
+}
+
+zone_type_id zone_manager::zone_type_for_item( const item &it, const bool custom_accepts,
+        const std::function<bool( const zone_type_id & )> &is_near )
 {
     const item_category &cat = it.get_category();
 
-    if( has_near( zone_LOOT_CUSTOM, where, range ) ) {
-        if( !get_near( zone_LOOT_CUSTOM, where, range, &it ).empty() ) {
-            return zone_LOOT_CUSTOM;
-        }
+    if( custom_accepts ) {
+        return zone_LOOT_CUSTOM;
     }
     if( it.has_flag( flag_FIREWOOD ) ) {
-        if( has_near( zone_LOOT_WOOD, where, range ) ) {
+        if( is_near( zone_LOOT_WOOD ) ) {
             return zone_LOOT_WOOD;
         }
     }
     if( it.is_corpse() ) {
-        if( has_near( zone_LOOT_CORPSE, where, range ) ) {
+        if( is_near( zone_LOOT_CORPSE ) ) {
             return zone_LOOT_CORPSE;
         }
     }
 
     cata::optional<zone_type_id> zone_check_first = cat.priority_zone( it );
-    if( zone_check_first && has_near( *zone_check_first, where, range ) ) {
+    if( zone_check_first && is_near( *zone_check_first ) ) {
         return *zone_check_first;
     }
 
@@ -881,14 +899,14 @@ zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
         // skip food without comestible, like MREs
         if( const item *it_food = it.get_food() ) {
             if( it_food->get_comestible()->comesttype == "DRINK" ) {
-                if( !preserves && it_food->goes_bad() && has_near( zone_LOOT_PDRINK, where, range ) ) {
+                if( !preserves && it_food->goes_bad() && is_near( zone_LOOT_PDRINK ) ) {
                     return zone_LOOT_PDRINK;
-                } else if( has_near( zone_LOOT_DRINK, where, range ) ) {
+                } else if( is_near( zone_LOOT_DRINK ) ) {
                     return zone_LOOT_DRINK;
                 }
             }
 
-            if( !preserves && it_food->goes_bad() && has_near( zone_LOOT_PFOOD, where, range ) ) {
+            if( !preserves && it_food->goes_bad() && is_near( zone_LOOT_PFOOD ) ) {
                 return zone_LOOT_PFOOD;
             }
         }
@@ -899,6 +917,99 @@ zone_type_id zone_manager::get_near_zone_type_for_item( const item &it,
     return zone_type_id();
 }
 
+loot_destinations::loot_destinations( const zone_manager &mgr, const tripoint &where,
+                                      const int range ) :
+    origin( where ), range( range ), revision( mgr.get_cache_revision() )
+{
+    std::map<const zone_data *, std::function<bool( const item & )>> zone_filters;
+    for( const auto &type : mgr.get_types() ) {
+        const std::unordered_set<tripoint> near = mgr.get_near( type.first, where, range );
+        if( near.empty() ) {
+            continue;
+        }
+        near_tiles[type.first].assign( near.begin(), near.end() );
+        for( const tripoint &tile : near ) {
+            if( custom_filters.count( tile ) || !mgr.has( zone_LOOT_CUSTOM, tile ) ) {
+                continue;
+            }
+            const zone_data *zone = mgr.get_zone_at( tile, zone_LOOT_CUSTOM );
+            auto filter = zone_filters.find( zone );
+            if( filter == zone_filters.end() ) {
+                std::function<bool( const item & )> accepts = []( const item & ) {
+                    return false;
+                };
+                if( zone ) {
+                    const loot_options &options = dynamic_cast<const loot_options &>( zone->get_options() );
+                    accepts = item_filter_from_string( options.get_mark() );
+                }
+                filter = zone_filters.emplace( zone, accepts ).first;
+            }
+            custom_filters.emplace( tile, filter->second );
+        }
+    }
+}
+
+bool loot_destinations::is_for( const zone_manager &mgr, const tripoint &where,
+                                const int range ) const
+{
+    return origin == where && this->range == range && revision == mgr.get_cache_revision();
+}
+
+bool loot_destinations::accepts( const tripoint &tile, const item &it ) const
+{
+    const auto filter = custom_filters.find( tile );
+    return filter == custom_filters.end() || filter->second( it );
+}
+
+zone_type_id loot_destinations::zone_type_for( const item &it ) const
+{
+    bool custom_accepts = false;
+    const auto custom = near_tiles.find( zone_LOOT_CUSTOM );
+    if( custom != near_tiles.end() ) {
+        custom_accepts = std::any_of( custom->second.begin(), custom->second.end(),
+        [&]( const tripoint & tile ) {
+            return accepts( tile, it );
+        } );
+    }
+    return zone_manager::zone_type_for_item( it, custom_accepts, [this]( const zone_type_id & type ) {
+        return near_tiles.count( type ) > 0;
+    } );
+}
+
+std::vector<tripoint> loot_destinations::tiles_for( const zone_type_id &type,
+        const item &it ) const
+{
+    std::vector<tripoint> tiles;
+    const auto near = near_tiles.find( type );
+    if( near != near_tiles.end() ) {
+        for( const tripoint &tile : near->second ) {
+            if( accepts( tile, it ) ) {
+                tiles.push_back( tile );
+            }
+        }
+    }
+    return tiles;
+}
+
+const loot_destinations &zone_manager::get_loot_destinations( const tripoint &where,
+        const int range ) const
+{
+    if( !loot_destinations_cache || !loot_destinations_cache->is_for( *this, where, range ) ) {
+        loot_destinations_cache.emplace( *this, where, range );
+    }
+    return *loot_destinations_cache;
+}
+
+zone_manager::loot_sort_stats_t &zone_manager::loot_sort_stats( const character_id &who )
+{
+    return loot_sort_stats_by_char[who];
+}
+
+void zone_manager::clear_loot_sort_stats( const character_id &who )
+{
+    loot_sort_stats_by_char.erase( who );
+}
+
 std::vector<zone_data> zone_manager::get_zones( const zone_type_id &type,
         const tripoint &where, const faction_id &fac ) const
 {
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_CLZONES_H
 #define CATA_SRC_CLZONES_H
 
+#include <chrono>
 #include <cstddef>
 #include <functional>
 #include <map>
@@ -13,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "character_id.h"
 #include "memory_fast.h"
 #include "optional.h"
 #include "point.h"
@@ -339,12 +341,48 @@ class zone_data
         void deserialize( JsonIn &jsin );
 };
 
+class zone_manager;
+
+/**
+ * Loot zones within some range of one position. Sorting a pile asks the same zone questions
+ * for every item on it, so the answers are gathered once and kept until the sorter moves or
+ * the zone caches are rebuilt.
+ */
+class loot_destinations
+{
+    public:
+        loot_destinations( const zone_manager &mgr, const tripoint &where, int range );
+
+        bool is_for( const zone_manager &mgr, const tripoint &where, int range ) const;
+
+        /** Same as zone_manager::get_near_zone_type_for_item from the origin. */
+        zone_type_id zone_type_for( const item &it ) const;
+
+        /** Same as zone_manager::get_near for the item from the origin. */
+        std::vector<tripoint> tiles_for( const zone_type_id &type, const item &it ) const;
+
+    private:
+        bool accepts( const tripoint &tile, const item &it ) const;
+
+        tripoint origin;
+        int range;
+        int revision;
+        std::map<zone_type_id, std::vector<tripoint>> near_tiles;
+        /** Filter of the custom loot zone covering a tile, for every such near tile */
+        std::unordered_map<tripoint, std::function<bool( const item & )>> custom_filters;
+};
+
 class zone_manager
 {
     public:
         using ref_zone_data = std::reference_wrapper<zone_data>;
         using ref_const_zone_data = std::reference_wrapper<const zone_data>;
 
+        struct loot_sort_stats_t {
+            int moved = 0;
+            std::chrono::steady_clock::duration time = std::chrono::steady_clock::duration::zero();
+        };
+
     private:
         static const int MAX_DISTANCE = 10;
         std::vector<zone_data> zones;
@@ -359,13 +397,20 @@ class zone_manager
         std::map<zone_type_id, zone_type> types;
         std::unordered_map<std::string, std::unordered_set<tripoint>> area_cache;
         std::unordered_map<std::string, std::unordered_set<tripoint>> vzone_cache;
-        std::unordered_set<tripoint> get_point_set( const zone_type_id &type,
+        const std::unordered_set<tripoint> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
+        /** See get_cache_revision() */
+        int cache_revision = 0;
+        void bump_cache_revision();
 
         //Cache number of items already checked on each source tile when sorting
         std::unordered_map<tripoint, int> num_processed;
+        /** See get_loot_destinations() */
+        mutable cata::optional<loot_destinations> loot_destinations_cache;
+        /** See loot_sort_stats(); not saved */
+        std::map<character_id, loot_sort_stats_t> loot_sort_stats_by_char;
 
         zone_manager();
         ~zone_manager() = default;
@@ -399,6 +444,13 @@ class zone_manager
         bool has_defined( const zone_type_id &type, const faction_id &fac = your_fac ) const;
         void cache_data();
         void cache_vzones();
+        /**
+         * Changes whenever @ref cache_data or @ref cache_vzones rebuild the zone caches, so
+         * results derived from them can be kept until then.
+         */
+        int get_cache_revision() const {
+            return cache_revision;
+        }
         bool has( const zone_type_id &type, const tripoint &where,
                   const faction_id &fac = your_fac ) const;
         bool has_near( const zone_type_id &type, const tripoint &where, int range = MAX_DISTANCE,
@@ -411,6 +463,19 @@ class zone_manager
                                               int range = MAX_DISTANCE, const faction_id &fac = your_fac ) const;
         zone_type_id get_near_zone_type_for_item( const item &it, const tripoint &where,
                 int range = MAX_DISTANCE ) const;
+        /**
+         * The decision behind @ref get_near_zone_type_for_item, for callers that already know
+         * which zone types are near. @p custom_accepts tells whether any near custom loot zone
+         * accepts the item.
+         */
+        static zone_type_id zone_type_for_item( const item &it, bool custom_accepts,
+                                                const std::function<bool( const zone_type_id & )> &is_near );
+        /** Loot destinations within @p range of @p where, reused while neither changes. */
+        const loot_destinations &get_loot_destinations( const tripoint &where, int range ) const;
+        /** Items moved and real time spent by @p who in the current loot sorting, for the debug log */
+        loot_sort_stats_t &loot_sort_stats( const character_id &who );
+        /** Forgets @p who's loot sorting stats once the sorting is done */
+        void clear_loot_sort_stats( const character_id &who );
         std::vector<zone_data> get_zones( const zone_type_id &type, const tripoint &where,
                                           const faction_id &fac = your_fac ) const;
         const zone_data *get_zone_at( const tripoint &where ) const;
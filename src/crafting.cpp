@@ -557,32 +557,67 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
     if( src_pos == tripoint_zero ) {
         inv_pos = pos();
     }
+    const map &here = get_map();
+    const int map_revision = here.get_contents_revision();
     if( cached_moves == moves
         && cached_time == calendar::turn
-        && cached_position == inv_pos ) {
+        && cached_position == inv_pos
+        && cached_radius == radius
+        && cached_clear_path == clear_path
+        && cached_map_revision == map_revision ) {
         return cached_crafting_inventory;
     }
-    cached_crafting_inventory.form_from_map( inv_pos, radius, this, false, clear_path );
-    cached_crafting_inventory += inv;
-    cached_crafting_inventory += weapon;
-    cached_crafting_inventory += worn;
+    // Forming the inventory from the map is the expensive part, and the map usually
+    // stays the same while the character is crafting or spending moves.
+    const int charges_revision = here.get_charges_revision();
+    if( cached_map_inventory_position != inv_pos
+        || cached_map_inventory_radius != radius
+        || cached_map_inventory_clear_path != clear_path
+        || cached_map_inventory_revision != map_revision
+        || cached_map_inventory_charges_revision != charges_revision ) {
+        cached_crafting_inventory.form_from_map( inv_pos, radius, this, false, clear_path );
+        cached_crafting_inventory.set_lower_layer();
+        cached_map_inventory_position = inv_pos;
+        cached_map_inventory_radius = radius;
+        cached_map_inventory_clear_path = clear_path;
+        cached_map_inventory_revision = map_revision;
+        cached_map_inventory_charges_revision = charges_revision;
+    } else {
+        cached_crafting_inventory.drop_upper_layer();
+    }
+    // Not stacked with the map items, so that they can be dropped again
+    const auto add_own_item = [this]( const item & it ) {
+        cached_crafting_inventory.add_item( it, true, false, false );
+    };
+    for( const std::list<item> *stack : inv.const_slice() ) {
+        for( const item &it : *stack ) {
+            add_own_item( it );
+        }
+    }
+    add_own_item( weapon );
+    for( const item &it : worn ) {
+        add_own_item( it );
+    }
     for( const bionic &bio : *my_bionics ) {
         const bionic_data &bio_data = bio.info();
         if( ( !bio_data.activated || bio.powered ) &&
             !bio_data.fake_item.is_empty() ) {
-            cached_crafting_inventory += item( bio.info().fake_item,
-                                               calendar::turn, units::to_kilojoule( get_power_level() ) );
+            add_own_item( item( bio.info().fake_item, calendar::turn,
+                                units::to_kilojoule( get_power_level() ) ) );
         }
     }
     if( has_trait( trait_BURROW ) ) {
-        cached_crafting_inventory += item( "pickaxe", calendar::turn );
-        cached_crafting_inventory += item( "shovel", calendar::turn );
+        add_own_item( item( "pickaxe", calendar::turn ) );
+        add_own_item( item( "shovel", calendar::turn ) );
     }
 
     cached_moves = moves;
     cached_time = calendar::turn;
     cached_position = inv_pos;
-    // cache the qualities of the items in cached_crafting_inventory
+    cached_radius = radius;
+    cached_clear_path = clear_path;
+    cached_map_revision = map_revision;
+    // cache the qualities of the items in cached_crafting_inventory, the map layer's are kept
     cached_crafting_inventory.update_quality_cache();
     return cached_crafting_inventory;
 }
@@ -591,6 +626,7 @@ void Character::invalidate_crafting_inventory()
 {
     cached_time = calendar::before_time_starts;
     cached_position = tripoint_min;
+    cached_map_inventory_position = tripoint_min;
 }
 
 void player::make_craft( const recipe_id &id_to_make, int batch_size, const tripoint &loc )
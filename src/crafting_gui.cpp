@@ -243,20 +243,27 @@ const recipe *select_crafting_recipe( int &batch_size )
     std::vector<const recipe *> current;
 
     struct availability {
-        availability( const recipe *r, int batch_size, bool known ) {
+        availability( const recipe *r, const inventory &inv, int batch_size, bool known ) {
             this->known = known;
-            const inventory &inv = get_avatar().crafting_inventory();
             auto all_items_filter = r->get_component_filter( recipe_filter_flags::none );
-            auto no_rotten_filter = r->get_component_filter( recipe_filter_flags::no_rotten );
             const deduped_requirement_data &req = r->deduped_requirements();
             could_craft_if_knew = req.can_make_with_inventory(
                                       inv, all_items_filter, batch_size, cost_adjustment::start_only );
             can_craft = known && could_craft_if_knew;
-            can_craft_non_rotten = req.can_make_with_inventory(
-                                       inv, no_rotten_filter, batch_size, cost_adjustment::start_only );
-            const requirement_data &simple_req = r->simple_requirements();
-            apparently_craftable = simple_req.can_make_with_inventory(
-                                       inv, all_items_filter, batch_size, cost_adjustment::start_only );
+            // Non-rotten components are a subset of all usable ones,
+            // and deduplicated requirements are stricter than the simple ones,
+            // so only check what can still differ from the result above.
+            if( could_craft_if_knew ) {
+                auto no_rotten_filter = r->get_component_filter( recipe_filter_flags::no_rotten );
+                can_craft_non_rotten = req.can_make_with_inventory(
+                                           inv, no_rotten_filter, batch_size, cost_adjustment::start_only );
+                apparently_craftable = true;
+            } else {
+                can_craft_non_rotten = false;
+                const requirement_data &simple_req = r->simple_requirements();
+                apparently_craftable = simple_req.can_make_with_inventory(
+                                           inv, all_items_filter, batch_size, cost_adjustment::start_only );
+            }
         }
         bool can_craft;
         bool can_craft_non_rotten;
@@ -611,10 +618,17 @@ const recipe *select_crafting_recipe( int &batch_size )
 
             if( batch ) {
                 current.clear();
+                const bool known = !show_unavailable || available_recipes.contains( *chosen );
                 for( int i = 1; i <= 50; i++ ) {
                     current.push_back( chosen );
-                    available.push_back( availability( chosen, i,
-                                                       !show_unavailable || available_recipes.contains( *chosen ) ) );
+                    // Requirements only grow with batch size, nothing bigger than
+                    // an uncraftable batch needs to be checked.
+                    if( !available.empty() && !available.back().apparently_craftable ) {
+                        const availability smaller_batch = available.back();
+                        available.push_back( smaller_batch );
+                    } else {
+                        available.push_back( availability( chosen, crafting_inv, i, known ) );
+                    }
                 }
             } else {
                 std::vector<const recipe *> picking;
@@ -714,7 +728,7 @@ const recipe *select_crafting_recipe( int &batch_size )
                 // cache recipe availability on first display
                 for( const recipe *e : current ) {
                     if( availability_cache.count( e ) == 0 ) {
-                        availability_cache.emplace( e, availability( e, 1,
+                        availability_cache.emplace( e, availability( e, crafting_inv, 1,
                                                     !show_unavailable || available_recipes.contains( *e ) ) );
                     }
                 }
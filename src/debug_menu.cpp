@@ -57,6 +57,7 @@
 #include "map_extras.h"
 #include "map_iterator.h"
 #include "mapgen.h"
+#include "mapgen_functions.h"
 #include "mapgendata.h"
 #include "martialarts.h"
 #include "memory_fast.h"
@@ -452,6 +453,7 @@ void spawn_nested_mapgen()
             return;
         }
         ( *ptr )->nest( md, local_ms.xy() );
+        resolve_regional_terrain_and_furniture( md );
         target_map.save();
         g->load_npcs();
         here.invalidate_map_cache( g->get_levz() );
@@ -1397,6 +1399,14 @@ void debug()
                        MonsterGenerator::generator().m_flag_usage_stats.end(), 0 );
             popup_top( "Monster flag usage statistics were dumped to debug.log and cleared." );
 
+            const map::sight_cache_stats &sight_stats = get_map().get_sight_cache_stats();
+            const int sight_queries = sight_stats.hits + sight_stats.misses;
+            DebugLog( DL::Info, DC::Main ) << "Line of sight cache: " << sight_stats.hits << " hits, " <<
+                                           sight_stats.misses << " misses";
+            add_msg( m_info, _( "Line of sight cache hit rate: %d / %d (%.1f%%)" ), sight_stats.hits,
+                     sight_queries, sight_queries > 0 ? 100.0 * sight_stats.hits / sight_queries : 0.0 );
+            get_map().reset_sight_cache_stats();
+
             std::string s = _( "Location %d:%d in %d:%d, %s\n" );
             s += _( "Current turn: %d.\n%s\n" );
             s += vgettext( "%d creature exists.\n", "%d creatures exist.\n", g->num_creatures() );
@@ -71,6 +71,8 @@ void distribution_grid::update( time_point to )
 static itype_id itype_battery( "battery" );
 int distribution_grid::mod_resource( int amt, bool recurse )
 {
+    // Grid-powered furniture contributes its charges to nearby inventories
+    get_map().bump_charges_revision();
     std::vector<vehicle *> connected_vehicles;
     for( const auto &c : contents ) {
         for( const tile_location &loc : c.second ) {
@@ -2150,8 +2150,7 @@ void editmap::cleartmpmap( tinymap &tmpmap )
     }
 
     auto &ch = tmpmap.get_cache( target.z );
-    std::memset( ch.veh_exists_at, 0, sizeof( ch.veh_exists_at ) );
-    ch.veh_cached_parts.clear();
+    ch.clear_veh_cached_parts();
     ch.vehicle_list.clear();
     ch.zone_vehicles.clear();
 }
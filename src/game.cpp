@@ -616,6 +616,7 @@ void game::setup()
 
     remoteveh_cache_time = calendar::before_time_starts;
     remoteveh_cache = nullptr;
+    last_draw_map_state.reset();
 
     token_provider_ptr->clear();
     // back to menu for save loading, new game etc
@@ -2878,6 +2879,7 @@ bool game::load( const save_t &name )
     }
 
     u.load_map_memory();
+    last_draw_map_state.reset();
 
     get_weather().nextweather = calendar::turn;
 
@@ -2976,6 +2978,12 @@ void game::load_world_modfiles( loading_ui &ui )
     load_data_from_dir( get_world_base_save_path() + "/mods", "custom", ui );
 
     DynamicDataLoader::get_instance().finalize_loaded_data( ui );
+#if defined(TILES)
+    // Not created when running tests
+    if( tilecontext ) {
+        tilecontext->clear_looks_like_cache();
+    }
+#endif // TILES
 }
 
 bool game::load_packs( const std::string &msg, const std::vector<mod_id> &packs, loading_ui &ui )
@@ -3468,8 +3476,20 @@ void game::draw()
 
     //temporary fix for updating visibility for minimap
     ter_view_p.z = ( u.pos() + u.view_offset ).z;
-    m.build_map_cache( ter_view_p.z );
-    m.update_visibility_cache( ter_view_p.z );
+    // Most redraws are caused by UI changes alone (menus, messages, cursor movement).
+    // Lighting and visibility only change with the game state, so they are only
+    // rebuilt when the turn, the player, the map contents or the map caches changed
+    // since the last draw.
+    const auto map_state = std::make_tuple( calendar::turn, u.pos(), u.moves, ter_view_p.z,
+                                            m.get_abs_sub(), m.get_contents_revision() );
+    const int minz = m.has_zlevels() ? -OVERMAP_DEPTH : ter_view_p.z;
+    const int maxz = m.has_zlevels() ? OVERMAP_HEIGHT : ter_view_p.z;
+    if( !last_draw_map_state || *last_draw_map_state != map_state ||
+        m.has_dirty_vision_caches( minz, maxz ) ) {
+        m.build_map_cache( ter_view_p.z );
+        m.update_visibility_cache( ter_view_p.z );
+        last_draw_map_state = map_state;
+    }
 
     werase( w_terrain );
     draw_ter();
@@ -12,6 +12,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -1091,6 +1092,8 @@ class game
         // remoteveh() cache
         time_point remoteveh_cache_time;
         vehicle *remoteveh_cache;
+        /** Turn, player, map and contents state that draw() last built lighting and visibility for */
+        cata::optional<std::tuple<time_point, tripoint, int, int, tripoint, int>> last_draw_map_state;
         /** Has a NPC been spawned since last load? */
         bool npcs_dirty = false;
         /** Has anything died in this turn and needs to be cleaned up? */
@@ -2,6 +2,7 @@
 
 #include <climits>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <algorithm>
@@ -234,11 +235,21 @@ static bool stack_compare( const std::list<item> &lhs, const std::list<item> &rh
     return lhs.front() < rhs.front();
 }
 
+void inventory::bump_revision()
+{
+    // Shared by all inventories, so that copies never collide with older contents
+    static int last_revision = 0;
+    revision = ++last_revision;
+}
+
 void inventory::clear()
 {
     items.clear();
+    bump_revision();
     binned = false;
     items_type_cached = false;
+    lower_layer_stacks = 0;
+    lower_layer_qualities.clear();
 }
 
 void inventory::push_back( const std::list<item> &newits )
@@ -284,6 +295,7 @@ char inventory::find_usable_cached_invlet( const itype_id &item_type )
 
 item &inventory::add_item( item newit, bool keep_invlet, bool assign_invlet, bool should_stack )
 {
+    bump_revision();
     binned = false;
     items_type_cached = false;
 
@@ -337,6 +349,7 @@ void inventory::build_items_type_cache()
 item &inventory::add_item_by_items_type_cache( item newit, bool keep_invlet, bool assign_invlet,
         bool should_stack )
 {
+    bump_revision();
     binned = false;
     if( !items_type_cached ) {
         debugmsg( "Tried to add item to inventory using cache without building the items_type_cache." );
@@ -509,7 +522,7 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
                                bool assign_invlet )
 {
     const time_point bday = calendar::start_of_cataclysm;
-    items.clear();
+    clear();
     build_items_type_cache();
     for( const tripoint &p : pts ) {
         if( m.has_furn( p ) ) {
@@ -695,6 +708,7 @@ std::list<item> inventory::reduce_stack( const int position, const int quantity
     std::list<item> ret;
     for( invstack::iterator iter = items.begin(); iter != items.end(); ++iter ) {
         if( position == pos ) {
+            bump_revision();
             binned = false;
             items_type_cached = false;
             if( quantity >= static_cast<int>( iter->size() ) || quantity < 0 ) {
@@ -731,6 +745,7 @@ item inventory::remove_item( const int position )
     int pos = 0;
     for( invstack::iterator iter = items.begin(); iter != items.end(); ++iter ) {
         if( position == pos ) {
+            bump_revision();
             binned = false;
             items_type_cached = false;
             if( iter->size() > 1 ) {
@@ -754,6 +769,7 @@ item inventory::remove_item( const int position )
 
 std::list<item> inventory::remove_randomly_by_volume( const units::volume &volume )
 {
+    bump_revision();
     std::list<item> result;
     units::volume volume_dropped = 0_ml;
     while( volume_dropped < volume ) {
@@ -852,6 +868,7 @@ int inventory::position_by_type( const itype_id &type ) const
 std::list<item> inventory::use_amount( itype_id it, int quantity,
                                        const std::function<bool( const item & )> &filter )
 {
+    bump_revision();
     items.sort( stack_compare );
     std::list<item> ret;
     for( invstack::iterator iter = items.begin(); iter != items.end() && quantity > 0; /* noop */ ) {
@@ -1113,8 +1130,9 @@ enchantment inventory::get_active_enchantment_cache( const Character &owner ) co
 
 void inventory::update_quality_cache()
 {
-    quality_cache.clear();
-    visit_items( [ this ]( const item * e ) {
+    // The lower layer was counted when it was set
+    quality_cache = lower_layer_qualities;
+    const auto count_qualities = [ this ]( const item * e ) {
         const std::map<quality_id, int> &item_qualities = e->get_qualities();
         for( const std::pair<const quality_id, int> &quality : item_qualities ) {
             const int item_count = e->count_by_charges() ? e->charges : 1;
@@ -1123,7 +1141,37 @@ void inventory::update_quality_cache()
             quality_cache[quality.first][quality.second] += item_count;
         }
         return VisitResponse::NEXT;
-    } );
+    };
+    auto stack = items.end();
+    std::advance( stack, -static_cast<std::ptrdiff_t>( items.size() - lower_layer_stacks ) );
+    for( ; stack != items.end(); ++stack ) {
+        for( item &it : *stack ) {
+            it.visit_items( count_qualities );
+        }
+    }
+}
+
+void inventory::set_lower_layer()
+{
+    lower_layer_stacks = 0;
+    lower_layer_qualities.clear();
+    update_quality_cache();
+    lower_layer_stacks = items.size();
+    lower_layer_qualities = quality_cache;
+}
+
+void inventory::drop_upper_layer()
+{
+    if( items.size() == lower_layer_stacks ) {
+        return;
+    }
+    while( items.size() > lower_layer_stacks ) {
+        items.pop_back();
+    }
+    bump_revision();
+    binned = false;
+    items_type_cached = false;
+    quality_cache = lower_layer_qualities;
 }
 
 const std::map<quality_id, std::map<int, int>> &inventory::get_quality_cache() const
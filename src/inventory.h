@@ -198,6 +198,14 @@ class inventory : public visitable<inventory>
         units::volume volume() const;
         units::volume volume_without( const excluded_stacks &without ) const;
 
+        /**
+         * Changes whenever items are added to or removed from any inventory. Equal revisions
+         * mean equal contents, unless items were modified in place through references.
+         */
+        int get_revision() const {
+            return revision;
+        }
+
         // dumps contents into dest (does not delete contents)
         void dump( std::vector<item *> &dest );
 
@@ -241,6 +249,16 @@ class inventory : public visitable<inventory>
         void update_quality_cache();
         const std::map<quality_id, std::map<int, int>> &get_quality_cache() const;
 
+        /**
+         * Makes the current items the lower layer. Items added afterwards form an upper layer
+         * that @ref drop_upper_layer removes again, so an inventory combining an expensive
+         * source with a cheap one only has to redo the cheap part. Items added to the upper
+         * layer must not be stacked into the lower one, and the lower layer must be left
+         * alone until @ref clear.
+         */
+        void set_lower_layer();
+        void drop_upper_layer();
+
         void build_items_type_cache();
 
     private:
@@ -250,9 +268,14 @@ class inventory : public visitable<inventory>
         invstack items;
         std::map<itype_id, std::list<std::list<item>*>> items_type_cache;
         std::map<quality_id, std::map<int, int>> quality_cache;
+        /** Number of stacks and quality cache of the lower layer, see @ref set_lower_layer */
+        size_t lower_layer_stacks = 0;
+        std::map<quality_id, std::map<int, int>> lower_layer_qualities;
 
         bool items_type_cached = false;
         mutable bool binned = false;
+        int revision = 0;
+        void bump_revision();
         /**
          * Items binned by their type.
          * That is, item_bin["carrot"] is a list of pointers to all carrots in inventory.
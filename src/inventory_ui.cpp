@@ -45,6 +45,7 @@
 #include <set>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 /** The maximum distance from the screen edge, to snap a window to it */
@@ -416,18 +417,6 @@ size_t inventory_column::get_entry_cell_width( size_t index, size_t cell_index )
     return res;
 }
 
-size_t inventory_column::get_entry_cell_width( const inventory_entry &entry,
-        size_t cell_index ) const
-{
-    size_t res = utf8_width( preset.get_cell_text( entry, cell_index ), true );
-
-    if( cell_index == 0 ) {
-        res += get_entry_indent( entry );
-    }
-
-    return res;
-}
-
 size_t inventory_column::get_cells_width() const
 {
     return std::accumulate( cells.begin(), cells.end(), static_cast<size_t>( 0 ), []( size_t lhs,
@@ -436,10 +425,31 @@ size_t inventory_column::get_cells_width() const
     } );
 }
 
+/**
+ * Whether everything @p to matches is also matched by @p from, i.e. @p to only appends to a
+ * search term, which can't widen a substring match. Lists, negations and braces are left out.
+ */
+static bool filter_narrows( const std::string &from, const std::string &to )
+{
+    if( from.empty() || to.size() < from.size() || to.compare( 0, from.size(), from ) != 0 ) {
+        return false;
+    }
+    if( to.find_first_of( ",-;{}" ) != std::string::npos ) {
+        return false;
+    }
+    // Appending a colon turns the term into a prefix
+    const size_t colon = to.find( ':' );
+    return colon == std::string::npos || colon < from.size();
+}
+
 void inventory_column::set_filter( const std::string &filter )
 {
-    entries = entries_unfiltered;
-    entries_cell_cache.clear();
+    // Narrowing the search only has to look at what the current one matched
+    if( !filter_narrows( current_filter, filter ) ) {
+        entries = entries_unfiltered;
+        entries_cell_cache.clear();
+    }
+    current_filter = filter;
     paging_is_valid = false;
     prepare_paging( filter );
 }
@@ -535,12 +545,22 @@ void inventory_column::expand_to_fit( const inventory_entry &entry )
     }
 
     // Don't use cell cache here since the entry may not yet be placed into the vector of entries.
-    const std::string denial = preset.get_denial( entry );
+    expand_to_fit( entry, make_entry_cell_cache( entry ) );
+}
+
+void inventory_column::expand_to_fit( const inventory_entry &entry,
+                                      const entry_cell_cache_t &texts )
+{
+    const std::string &denial = texts.denial;
+    const auto cell_width = [&]( size_t cell_index ) {
+        const size_t width = utf8_width( texts.text[cell_index], true );
+        return cell_index == 0 ? width + get_entry_indent( entry ) : width;
+    };
 
     for( size_t i = 0, num = denial.empty() ? cells.size() : 1; i < num; ++i ) {
         auto &cell = cells[i];
 
-        cell.real_width = std::max( cell.real_width, get_entry_cell_width( entry, i ) );
+        cell.real_width = std::max( cell.real_width, cell_width( i ) );
 
         // Don't reveal the cell for headers and stubs
         if( cell.visible() || ( entry.is_item() && !preset.is_stub_cell( entry, i ) ) ) {
@@ -550,8 +570,7 @@ void inventory_column::expand_to_fit( const inventory_entry &entry )
     }
 
     if( !denial.empty() ) {
-        reserved_width = std::max( get_entry_cell_width( entry, 0 ) + min_denial_gap + utf8_width( denial,
-                                   true ),
+        reserved_width = std::max( cell_width( 0 ) + min_denial_gap + utf8_width( denial, true ),
                                    reserved_width );
     }
 }
@@ -562,8 +581,10 @@ void inventory_column::reset_width( const std::vector<inventory_column *> & )
         elem = cell_t();
     }
     reserved_width = 0;
-    for( auto &elem : entries ) {
-        expand_to_fit( elem );
+    for( size_t i = 0; i < entries.size(); ++i ) {
+        if( entries[i] ) {
+            expand_to_fit( entries[i], get_entry_cell_cache( i ) );
+        }
     }
 }
 
@@ -718,9 +739,12 @@ void inventory_column::add_entry( const inventory_entry &entry )
         return cur_cat == new_cat || ( cur_cat != nullptr && new_cat != nullptr
                                        && ( *cur_cat == *new_cat || *cur_cat < *new_cat ) );
     } );
-    entries.insert( iter.base(), entry );
-    entries_cell_cache.clear();
-    expand_to_fit( entry );
+    const size_t index = std::distance( entries.begin(), iter.base() );
+    entry_cell_cache_t texts = make_entry_cell_cache( entry );
+    expand_to_fit( entry, texts );
+    entries_cell_cache.resize( entries.size() );
+    entries_cell_cache.insert( entries_cell_cache.begin() + index, std::move( texts ) );
+    entries.insert( entries.begin() + index, entry );
     paging_is_valid = false;
 }
 
@@ -749,59 +773,69 @@ void inventory_column::prepare_paging( const std::string &filter )
     } );
 
     // FIXME: toggled status of multiselect menu resets when filtering the menu
-    // First, remove all non-items
-    const auto new_end = std::remove_if( entries.begin(),
-    entries.end(), [&filter_fn]( const inventory_entry & entry ) {
-        return !entry.is_item() || !filter_fn( entry );
-    } );
-    entries.erase( new_end, entries.end() );
+    // First, remove all non-items. Cell texts stay with their entries, so refiltering and
+    // resorting don't generate them again.
+    entries_cell_cache.resize( entries.size() );
+    std::vector<std::pair<inventory_entry, entry_cell_cache_t>> rows;
+    rows.reserve( entries.size() );
+    for( size_t i = 0; i < entries.size(); ++i ) {
+        if( entries[i].is_item() && filter_fn( entries[i] ) ) {
+            rows.emplace_back( std::move( entries[i] ), std::move( entries_cell_cache[i] ) );
+        }
+    }
+    entries.clear();
+    entries_cell_cache.clear();
     // Then sort them with respect to categories
-    auto from = entries.begin();
-    while( from != entries.end() ) {
-        auto to = std::next( from );
-        while( to != entries.end() && from->get_category_ptr() == to->get_category_ptr() ) {
-            to->update_cache();
+    auto from = rows.begin();
+    while( from != rows.end() ) {
+        auto to = from;
+        while( to != rows.end() && from->first.get_category_ptr() == to->first.get_category_ptr() ) {
+            if( to->first.cached_name.empty() ) {
+                to->first.update_cache();
+            }
             std::advance( to, 1 );
         }
-        if( ordered_categories.count( from->get_category_ptr()->get_id().c_str() ) == 0 ) {
-            std::sort( from, to, [ this ]( const inventory_entry & lhs, const inventory_entry & rhs ) {
-                if( lhs.is_selectable() != rhs.is_selectable() ) {
-                    return lhs.is_selectable(); // Disabled items always go last
+        if( ordered_categories.count( from->first.get_category_ptr()->get_id().c_str() ) == 0 ) {
+            std::sort( from, to, [ this ]( const std::pair<inventory_entry, entry_cell_cache_t> &lhs,
+            const std::pair<inventory_entry, entry_cell_cache_t> &rhs ) {
+                if( lhs.first.is_selectable() != rhs.first.is_selectable() ) {
+                    return lhs.first.is_selectable(); // Disabled items always go last
                 }
-                return preset.sort_compare( lhs, rhs );
+                return preset.sort_compare( lhs.first, rhs.first );
             } );
         }
         from = to;
     }
     // Recover categories
     const item_category *current_category = nullptr;
-    for( auto iter = entries.begin(); iter != entries.end(); ++iter ) {
-        if( iter->get_category_ptr() == current_category ) {
-            continue;
-        }
-        current_category = iter->get_category_ptr();
-        iter = entries.insert( iter, inventory_entry( current_category ) );
-        expand_to_fit( *iter );
-    }
+    for( auto &row : rows ) {
+        if( row.first.get_category_ptr() != current_category ) {
+            current_category = row.first.get_category_ptr();
+            entries.emplace_back( current_category );
+            entries_cell_cache.emplace_back();
+            expand_to_fit( entries.back() );
+        }
+        entries.push_back( std::move( row.first ) );
+        entries_cell_cache.push_back( std::move( row.second ) );
+    }
+    const auto insert_entry = [this]( size_t index, const inventory_entry & entry ) {
+        entries.insert( entries.begin() + index, entry );
+        entries_cell_cache.emplace( entries_cell_cache.begin() + index );
+    };
     // Determine the new height.
     entries_per_page = height;
     if( entries.size() > entries_per_page ) {
         entries_per_page -= 1;  // Make room for the page number.
         for( size_t i = entries_per_page - 1; i < entries.size(); i += entries_per_page ) {
-            auto iter = std::next( entries.begin(), i );
-            if( iter->is_category() ) {
+            if( entries[i].is_category() ) {
                 // The last item on the page must not be a category.
-                entries.insert( iter, inventory_entry() );
-            } else {
+                insert_entry( i, inventory_entry() );
+            } else if( i + 1 < entries.size() && entries[i + 1].is_item() ) {
                 // The first item on the next page must be a category.
-                iter = std::next( iter );
-                if( iter != entries.end() && iter->is_item() ) {
-                    entries.insert( iter, inventory_entry( iter->get_category_ptr() ) );
-                }
+                insert_entry( i + 1, inventory_entry( entries[i + 1].get_category_ptr() ) );
             }
         }
     }
-    entries_cell_cache.clear();
     paging_is_valid = true;
     if( entries_unfiltered.empty() ) {
         entries_unfiltered = entries;
@@ -1042,6 +1076,8 @@ void selection_column::on_change( const inventory_entry &entry )
         } else {
             iter = entries.erase( iter );
         }
+        // There are only ever a few selected entries, so just drop all their texts
+        entries_cell_cache.clear();
         paging_is_valid = false;
 
         if( iter != entries.end() ) {
@@ -1051,42 +1087,25 @@ void selection_column::on_change( const inventory_entry &entry )
 }
 
 // TODO: Move it into some 'item_stack' class.
-static std::vector<std::list<item *>> restack_items( const std::list<item>::const_iterator &from,
-                                   const std::list<item>::const_iterator &to, bool check_components = false )
-{
-    std::vector<std::list<item *>> res;
-
-    for( auto it = from; it != to; ++it ) {
-        auto match = std::find_if( res.begin(), res.end(),
-        [ &it, check_components ]( const std::list<item *> &e ) {
-            return it->display_stacked_with( *const_cast<item *>( e.back() ), check_components );
-        } );
-
-        if( match != res.end() ) {
-            match->push_back( const_cast<item *>( &*it ) );
-        } else {
-            res.emplace_back( 1, const_cast<item *>( &*it ) );
-        }
-    }
-
-    return res;
-}
-
-// TODO: Move it into some 'item_stack' class.
-static std::vector<std::list<item *>> restack_items( const item_stack::const_iterator &from,
-                                   const item_stack::const_iterator &to, bool check_components = false )
+template<typename Iter>
+static std::vector<std::list<item *>> restack_items( const Iter &from, const Iter &to,
+                                   bool check_components = false )
 {
     std::vector<std::list<item *>> res;
+    // Stacks whose items hash the same way, in the order they were created
+    std::unordered_map<size_t, std::vector<size_t>> buckets;
 
     for( auto it = from; it != to; ++it ) {
-        auto match = std::find_if( res.begin(), res.end(),
-        [ &it, check_components ]( const std::list<item *> &e ) {
-            return it->display_stacked_with( *const_cast<item *>( e.back() ), check_components );
+        std::vector<size_t> &bucket = buckets[it->stacking_hash()];
+        auto match = std::find_if( bucket.begin(), bucket.end(),
+        [ &it, &res, check_components ]( const size_t idx ) {
+            return it->display_stacked_with( *res[idx].back(), check_components );
         } );
 
-        if( match != res.end() ) {
-            match->push_back( const_cast<item *>( &*it ) );
+        if( match != bucket.end() ) {
+            res[*match].push_back( const_cast<item *>( &*it ) );
         } else {
+            bucket.push_back( res.size() );
             res.emplace_back( 1, const_cast<item *>( &*it ) );
         }
     }
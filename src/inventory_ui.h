@@ -363,17 +363,22 @@ class inventory_column
          *  then a value returned by  inventory_column::get_entry_indent() is added to the result.
          */
         size_t get_entry_cell_width( size_t index, size_t cell_index ) const;
-        size_t get_entry_cell_width( const inventory_entry &entry, size_t cell_index ) const;
         /** Sum of the cell widths */
         size_t get_cells_width() const;
 
         entry_cell_cache_t make_entry_cell_cache( const inventory_entry &entry ) const;
+        /** Widen the cells to fit the already generated @p texts of @p entry */
+        void expand_to_fit( const inventory_entry &entry, const entry_cell_cache_t &texts );
         const entry_cell_cache_t &get_entry_cell_cache( size_t index ) const;
 
         const inventory_selector_preset &preset;
 
         std::vector<inventory_entry> entries;
         std::vector<inventory_entry> entries_unfiltered;
+        /** Cell texts of @ref entries, by index and generated as they are needed */
+        mutable std::vector<entry_cell_cache_t> entries_cell_cache;
+        /** Filter the entries were last filtered with */
+        std::string current_filter;
         navigation_mode mode = navigation_mode::ITEM;
         bool active = false;
         bool multiselect = false;
@@ -401,7 +406,6 @@ class inventory_column
         };
 
         std::vector<cell_t> cells;
-        mutable std::vector<entry_cell_cache_t> entries_cell_cache;
 
         /** @return Number of visible cells */
         size_t visible_cells() const;
@@ -50,6 +50,7 @@
 #include "game.h"
 #include "game_constants.h"
 #include "gun_mode.h"
+#include "hash_utils.h"
 #include "iexamine.h"
 #include "int_id.h"
 #include "inventory.h"
@@ -967,6 +968,28 @@ bool item::stacks_with( const item &rhs, bool check_components, bool skip_type_c
     return contents.stacks_with( rhs.contents );
 }
 
+size_t item::stacking_hash() const
+{
+    size_t seed = 0;
+    cata::hash_combine( seed, type );
+    if( is_money() ) {
+        // Nonempty cash cards stack regardless of everything below
+        return seed;
+    }
+    if( !count_by_charges() ) {
+        cata::hash_combine( seed, charges );
+    }
+    cata::hash_combine( seed, is_favorite );
+    cata::hash_combine( seed, damage_ );
+    cata::hash_combine( seed, burnt );
+    cata::hash_combine( seed, active );
+    cata::hash_combine( seed, item_tags.size() );
+    cata::hash_combine( seed, item_vars.size() );
+    cata::hash_combine( seed, corpse != nullptr ? corpse->id.str() : std::string() );
+    cata::hash_combine( seed, contents.num_item_stacks() );
+    return seed;
+}
+
 bool item::merge_charges( const item &rhs )
 {
     if( !count_by_charges() || !stacks_with( rhs ) ) {
@@ -993,72 +1016,48 @@ void item::put_in( const item &payload )
 
 void item::set_var( const std::string &name, const int value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, static_cast<long long>( value ) );
 }
 
 void item::set_var( const std::string &name, const long long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, value );
 }
 
 // NOLINTNEXTLINE(cata-no-long)
 void item::set_var( const std::string &name, const long value )
 {
-    std::ostringstream tmpstream;
-    tmpstream.imbue( std::locale::classic() );
-    tmpstream << value;
-    item_vars[name] = tmpstream.str();
+    item_vars.set( name, static_cast<long long>( value ) );
 }
 
 void item::set_var( const std::string &name, const double value )
 {
-    item_vars[name] = string_format( "%f", value );
+    item_vars.set( name, value );
 }
 
 double item::get_var( const std::string &name, const double default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
-        return default_value;
-    }
-    return atof( it->second.c_str() );
+    return item_vars.get( name, default_value );
 }
 
 void item::set_var( const std::string &name, const tripoint &value )
 {
-    item_vars[name] = string_format( "%d,%d,%d", value.x, value.y, value.z );
+    item_vars.set( name, value );
 }
 
 tripoint item::get_var( const std::string &name, const tripoint &default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
-        return default_value;
-    }
-    std::vector<std::string> values = string_split( it->second, ',' );
-    return tripoint( atoi( values[0].c_str() ),
-                     atoi( values[1].c_str() ),
-                     atoi( values[2].c_str() ) );
+    return item_vars.get( name, default_value );
 }
 
 void item::set_var( const std::string &name, const std::string &value )
 {
-    item_vars[name] = value;
+    item_vars.set( name, value );
 }
 
 std::string item::get_var( const std::string &name, const std::string &default_value ) const
 {
-    const auto it = item_vars.find( name );
-    if( it == item_vars.end() ) {
-        return default_value;
-    }
-    return it->second;
+    return item_vars.get( name, default_value );
 }
 
 std::string item::get_var( const std::string &name ) const
@@ -1068,7 +1067,7 @@ std::string item::get_var( const std::string &name ) const
 
 bool item::has_var( const std::string &name ) const
 {
-    return item_vars.count( name ) > 0;
+    return item_vars.contains( name );
 }
 
 void item::erase_var( const std::string &name )
@@ -1505,14 +1504,12 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
 
     if( parts->test( iteminfo_parts::DESCRIPTION ) ) {
         insert_separation_line( info );
-        const std::map<std::string, std::string>::const_iterator idescription =
-            item_vars.find( "description" );
         const cata::optional<translation> snippet = SNIPPET.get_snippet_by_id( snip_id );
         if( snippet.has_value() ) {
             // Just use the dynamic description
             info.push_back( iteminfo( "DESCRIPTION", snippet.value().translated() ) );
-        } else if( idescription != item_vars.end() ) {
-            info.push_back( iteminfo( "DESCRIPTION", idescription->second ) );
+        } else if( has_var( "description" ) ) {
+            info.push_back( iteminfo( "DESCRIPTION", get_var( "description" ) ) );
         } else {
             if( has_flag( "MAGIC_FOCUS" ) ) {
                 info.push_back( iteminfo( "DESCRIPTION",
@@ -1599,7 +1596,7 @@ void item::basic_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
                                       burnt ) );
             const std::string tags_listed = enumerate_as_string( item_tags, enumeration_conjunction::none );
             info.push_back( iteminfo( "BASE", string_format( _( "tags: %s" ), tags_listed ) ) );
-            for( auto const &imap : item_vars ) {
+            for( auto const &imap : item_vars.to_map() ) {
                 info.push_back( iteminfo( "BASE",
                                           string_format( _( "item var: %s, %s" ), imap.first,
                                                   imap.second ) ) );
@@ -3776,25 +3773,22 @@ void item::final_info( std::vector<iteminfo> &info, const iteminfo_query *parts,
         }
     }
 
-    std::map<std::string, std::string>::const_iterator item_note = item_vars.find( "item_note" );
-    std::map<std::string, std::string>::const_iterator item_note_tool =
-        item_vars.find( "item_note_tool" );
-
-    if( item_note != item_vars.end() && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
+    if( has_var( "item_note" ) && parts->test( iteminfo_parts::DESCRIPTION_NOTES ) ) {
         insert_separation_line( info );
+        const std::string item_note = get_var( "item_note" );
         std::string ntext;
         const inscribe_actor *use_actor = nullptr;
-        if( item_note_tool != item_vars.end() ) {
-            const use_function *use_func = itype_id( item_note_tool->second )->get_use( "inscribe" );
+        if( has_var( "item_note_tool" ) ) {
+            const use_function *use_func = itype_id( get_var( "item_note_tool" ) )->get_use( "inscribe" );
             use_actor = dynamic_cast<const inscribe_actor *>( use_func->get_actor_ptr() );
         }
         if( use_actor ) {
             //~ %1$s: gerund (e.g. carved), %2$s: item name, %3$s: inscription text
             ntext = string_format( pgettext( "carving", "%1$s on the %2$s is: %3$s" ),
-                                   use_actor->gerund, tname(), item_note->second );
+                                   use_actor->gerund, tname(), item_note );
         } else {
             //~ %1$s: inscription text
-            ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note->second );
+            ntext = string_format( pgettext( "carving", "Note: %1$s" ), item_note );
         }
         info.push_back( iteminfo( "DESCRIPTION", ntext ) );
     }
@@ -4513,7 +4507,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
     }
 
     std::string maintext;
-    if( is_corpse() || typeId() == itype_blood || item_vars.find( "name" ) != item_vars.end() ) {
+    if( is_corpse() || typeId() == itype_blood || has_var( "name" ) ) {
         maintext = type_name( quantity );
     } else if( is_gun() || is_tool() || is_magazine() ) {
         int amt = 0;
@@ -4668,7 +4662,7 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
         ret = utf8_truncate( ret, truncate + truncate_override );
     }
 
-    if( item_vars.find( "item_note" ) != item_vars.end() ) {
+    if( has_var( "item_note" ) ) {
         //~ %s is an item name. This style is used to denote items with notes.
         return string_format( _( "*%s*" ), ret );
     } else {
@@ -5185,9 +5179,13 @@ bool item::has_own_flag( const std::string &f ) const
 
 bool item::has_flag( const std::string &f ) const
 {
-    bool ret = false;
+    return has_flag( flag_str_id( f ) );
+}
 
-    if( json_flag::get( f ).inherit() ) {
+bool item::has_flag( const flag_str_id &f ) const
+{
+    // undefined flags are inherited, just like the null json_flag says
+    if( !contents.empty() && ( !f.is_valid() || f->inherit() ) ) {
         for( const item *e : is_gun() ? gunmods() : toolmods() ) {
             // gunmods fired separately do not contribute to base gun flags
             if( !e->is_gun() && e->has_flag( f ) ) {
@@ -5197,19 +5195,12 @@ bool item::has_flag( const std::string &f ) const
     }
 
     // other item type flags
-    ret = type->has_flag( f );
-    if( ret ) {
-        return ret;
+    if( type->has_flag( f ) ) {
+        return true;
     }
 
     // now check for item specific flags
-    ret = has_own_flag( f );
-    return ret;
-}
-
-bool item::has_flag( const flag_str_id &flag ) const
-{
-    return has_flag( flag.str() );
+    return has_own_flag( f.str() );
 }
 
 item &item::set_flag( const std::string &flag )
@@ -8683,26 +8674,26 @@ bool item_compare_by_charges( const item &left, const item &right )
 static const std::string USED_BY_IDS( "USED_BY_IDS" );
 bool item::already_used_by_player( const player &p ) const
 {
-    const auto it = item_vars.find( USED_BY_IDS );
-    if( it == item_vars.end() ) {
+    if( !has_var( USED_BY_IDS ) ) {
         return false;
     }
     // USED_BY_IDS always starts *and* ends with a ';', the search string
     // ';<id>;' matches at most one part of USED_BY_IDS, and only when exactly that
     // id has been added.
     const std::string needle = string_format( ";%d;", p.getID().get_value() );
-    return it->second.find( needle ) != std::string::npos;
+    return get_var( USED_BY_IDS ).find( needle ) != std::string::npos;
 }
 
 void item::mark_as_used_by_player( const player &p )
 {
-    std::string &used_by_ids = item_vars[ USED_BY_IDS ];
+    std::string used_by_ids = get_var( USED_BY_IDS );
     if( used_by_ids.empty() ) {
         // *always* start with a ';'
         used_by_ids = ";";
     }
     // and always end with a ';'
     used_by_ids += string_format( "%d;", p.getID().get_value() );
+    set_var( USED_BY_IDS, used_by_ids );
 }
 
 bool item::can_holster( const item &obj, bool ignore ) const
@@ -9671,7 +9662,6 @@ bool item::is_reloadable() const
 
 std::string item::type_name( unsigned int quantity ) const
 {
-    const auto iter = item_vars.find( "name" );
     std::string ret_name;
     if( typeId() == itype_blood ) {
         if( corpse == nullptr || corpse->id.is_null() ) {
@@ -9681,8 +9671,8 @@ std::string item::type_name( unsigned int quantity ) const
                                              "%s blood",  quantity ),
                                   corpse->nname() );
         }
-    } else if( iter != item_vars.end() ) {
-        return iter->second;
+    } else if( has_var( "name" ) ) {
+        return get_var( "name" );
     } else {
         ret_name = type->nname( quantity );
     }
@@ -20,6 +20,7 @@
 #include "io_tags.h"
 #include "item_contents.h"
 #include "item_location.h"
+#include "item_var_map.h"
 #include "optional.h"
 #include "pimpl.h"
 #include "safe_reference.h"
@@ -532,6 +533,14 @@ class item : public visitable<item>
         bool display_stacked_with( const item &rhs, bool check_components = false ) const;
         bool stacks_with( const item &rhs, bool check_components = false,
                           bool skip_type_check = false ) const;
+        /**
+         * Hash of the properties @ref stacks_with compares for equality, so that items that
+         * stack always have the same hash. Lets piles be grouped into stacks by bucket
+         * instead of comparing every item with every stack. Not cached, since most of
+         * those properties can be changed directly; it only reads a handful of fields.
+         * Means nothing for comparisons that skip the type check.
+         */
+        size_t stacking_hash() const;
         /**
          * Merge charges of the other item into this item.
          * @return true if the items have been merged, otherwise false.
@@ -2164,7 +2173,7 @@ class item : public visitable<item>
     private:
         safe_reference_anchor anchor;
         const itype *curammo = nullptr;
-        std::map<std::string, std::string> item_vars;
+        item_var_map item_vars;
         const mtype *corpse = nullptr;
         std::string corpse_name;       // Name of the late lamented
         std::set<matec_id> techniques; // item specific techniques
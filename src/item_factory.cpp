@@ -599,6 +599,7 @@ void Item_factory::finalize_post( itype &obj )
             return false;
         }
     } );
+    obj.cache_flags();
 
     // handle complex firearms as a special case
     if( obj.gun && !obj.has_flag( "PRIMITIVE_RANGED_WEAPON" ) ) {
@@ -1098,6 +1099,7 @@ void Item_factory::init()
     m_template_groups[item_group_id( "EMPTY_GROUP" )] = std::make_unique<Item_group>
             ( Item_group::G_COLLECTION, 100, 0,
               0 );
+    bump_group_revision();
 }
 
 bool Item_factory::check_ammo_type( std::string &msg, const ammotype &ammo ) const
@@ -1548,6 +1550,7 @@ const itype *Item_factory::find_template( const itype_id &id ) const
         def->id = id;
         def->name = no_translation( string_format( "DEBUG: %s", id.c_str() ) );
         def->description = making_id.obj().description;
+        def->cache_flags();
         m_runtimes[ id ].reset( def );
         return def;
     }
@@ -1558,11 +1561,19 @@ const itype *Item_factory::find_template( const itype_id &id ) const
     def->id = id;
     def->name = no_translation( string_format( "undefined-%s", id.c_str() ) );
     def->description = no_translation( string_format( "Missing item definition for %s.", id.c_str() ) );
+    def->cache_flags();
 
     m_runtimes[ id ].reset( def );
     return def;
 }
 
+void Item_factory::bump_group_revision()
+{
+    // Shared by all factories, so that a recreated one never repeats an older revision
+    static int last_revision = 0;
+    group_revision = ++last_revision;
+}
+
 Item_spawn_data *Item_factory::get_group( const item_group_id &item_group_id )
 {
     GroupMap::iterator group_iter = m_template_groups.find( item_group_id );
@@ -2768,6 +2779,7 @@ void Item_factory::clear()
     m_abstracts.clear();
     m_runtimes.clear();
     m_template_groups.clear();
+    bump_group_revision();
     m_templates.clear();
 
     gun_tools.clear();
@@ -2973,6 +2985,7 @@ void Item_factory::load_item_group( const JsonArray &entries, const item_group_i
 {
     const auto type = is_collection ? Item_group::G_COLLECTION : Item_group::G_DISTRIBUTION;
     std::unique_ptr<Item_spawn_data> &isd = m_template_groups[group_id];
+    bump_group_revision();
     Item_group *const ig = make_group_or_throw( group_id, isd, type, ammo_chance, magazine_chance );
 
     for( const JsonObject subobj : entries ) {
@@ -2984,6 +2997,7 @@ void Item_factory::load_item_group( const JsonObject &jsobj, const item_group_id
                                     const std::string &subtype )
 {
     std::unique_ptr<Item_spawn_data> &isd = m_template_groups[group_id];
+    bump_group_revision();
 
     Item_group::Type type = Item_group::G_COLLECTION;
     if( subtype == "old" || subtype == "distribution" ) {
@@ -127,6 +127,13 @@ class Item_factory
          * Get the item group object. Returns null if the item group does not exists.
          */
         Item_spawn_data *get_group( const item_group_id &item_group_id );
+        /**
+         * Changes whenever item groups are added or removed, so that the pointers
+         * @ref get_group returns can be kept until then.
+         */
+        int get_group_revision() const {
+            return group_revision;
+        }
         /**
          * Returns the idents of all item groups that are known.
          */
@@ -249,6 +256,8 @@ class Item_factory
 
         using GroupMap = std::map<item_group_id, std::unique_ptr<Item_spawn_data>>;
         GroupMap m_template_groups;
+        int group_revision = 0;
+        void bump_group_revision();
 
         std::unordered_map<itype_id, ammotype> migrated_ammo;
         std::unordered_map<itype_id, itype_id> migrated_magazines;
@@ -62,7 +62,7 @@ item Single_item_creator::create_single( const time_point &birthday, RecursionLi
             return item( itype_id::NULL_ID(), birthday );
         }
         rec.push_back( id );
-        Item_spawn_data *isd = item_controller->get_group( item_group_id( id ) );
+        Item_spawn_data *isd = get_group();
         if( isd == nullptr ) {
             debugmsg( "unknown item spawn list %s", id.c_str() );
             return item( itype_id::NULL_ID(), birthday );
@@ -106,7 +106,7 @@ Item_spawn_data::ItemList Single_item_creator::create( const time_point &birthda
                 return result;
             }
             rec.push_back( id );
-            Item_spawn_data *isd = item_controller->get_group( item_group_id( id ) );
+            Item_spawn_data *isd = get_group();
             if( isd == nullptr ) {
                 debugmsg( "unknown item spawn list %s", id.c_str() );
                 return result;
@@ -124,6 +124,16 @@ Item_spawn_data::ItemList Single_item_creator::create( const time_point &birthda
     return result;
 }
 
+Item_spawn_data *Single_item_creator::get_group() const
+{
+    const int revision = item_controller->get_group_revision();
+    if( group_revision != revision ) {
+        group = item_controller->get_group( item_group_id( id ) );
+        group_revision = revision;
+    }
+    return group;
+}
+
 void Single_item_creator::check_consistency( const std::string &context ) const
 {
     if( type == S_ITEM ) {
@@ -464,6 +474,7 @@ void Item_group::add_entry( std::unique_ptr<Item_spawn_data> ptr )
         ptr->probability = std::min( 100, ptr->probability );
     }
     sum_prob += ptr->probability;
+    cumulative_prob.push_back( sum_prob );
 
     // Make the ammo and magazine probabilities from the outer entity apply to the nested entity:
     // If ptr is an Item_group, it already inherited its parent's ammo/magazine chances in its constructor.
@@ -486,15 +497,9 @@ Item_spawn_data::ItemList Item_group::create( const time_point &birthday, Recurs
             result.insert( result.end(), tmp.begin(), tmp.end() );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            p -= ( elem )->probability;
-            if( p >= 0 ) {
-                continue;
-            }
-            ItemList tmp = ( elem )->create( birthday, rec );
+        if( const Item_spawn_data *entry = pick_entry() ) {
+            ItemList tmp = entry->create( birthday, rec );
             result.insert( result.end(), tmp.begin(), tmp.end() );
-            break;
         }
     }
 
@@ -511,18 +516,25 @@ item Item_group::create_single( const time_point &birthday, RecursionList &rec )
             return ( elem )->create_single( birthday, rec );
         }
     } else if( type == G_DISTRIBUTION ) {
-        int p = rng( 0, sum_prob - 1 );
-        for( const auto &elem : items ) {
-            p -= ( elem )->probability;
-            if( p >= 0 ) {
-                continue;
-            }
-            return ( elem )->create_single( birthday, rec );
+        if( const Item_spawn_data *entry = pick_entry() ) {
+            return entry->create_single( birthday, rec );
         }
     }
     return item( itype_id::NULL_ID(), birthday );
 }
 
+const Item_spawn_data *Item_group::pick_entry() const
+{
+    const int p = rng( 0, sum_prob - 1 );
+    // The first entry whose running total exceeds the roll, as if subtracting the
+    // probabilities one by one
+    const auto iter = std::upper_bound( cumulative_prob.begin(), cumulative_prob.end(), p );
+    if( iter == cumulative_prob.end() ) {
+        return nullptr;
+    }
+    return items[iter - cumulative_prob.begin()].get();
+}
+
 void Item_group::check_consistency( const std::string &context ) const
 {
     for( const auto &elem : items ) {
@@ -540,6 +552,12 @@ bool Item_group::remove_item( const itype_id &itemid )
             ++a;
         }
     }
+    cumulative_prob.clear();
+    int running = 0;
+    for( const std::unique_ptr<Item_spawn_data> &elem : items ) {
+        running += elem->probability;
+        cumulative_prob.push_back( running );
+    }
     return items.empty();
 }
 
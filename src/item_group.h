@@ -241,6 +241,13 @@ class Single_item_creator : public Item_spawn_data
 
         bool has_item( const itype_id &itemid ) const override;
         std::set<const itype *> every_item() const override;
+
+    private:
+        /** The group an S_ITEM_GROUP entry spawns from, null if it does not exist */
+        Item_spawn_data *get_group() const;
+        /** Saved result of @ref get_group, valid while the item group revision is unchanged */
+        mutable Item_spawn_data *group = nullptr;
+        mutable int group_revision = -1;
 };
 
 /**
@@ -313,6 +320,14 @@ class Item_group : public Item_spawn_data
          * Links to the entries in this group.
          */
         prop_list items;
+        /**
+         * Running totals of the entry probabilities, so that a distribution finds the
+         * rolled entry by binary search.
+         */
+        std::vector<int> cumulative_prob;
+
+        /** Rolls the entry a distribution creates items from, nullptr if there is none */
+        const Item_spawn_data *pick_entry() const;
 };
 
 #endif // CATA_SRC_ITEM_GROUP_H
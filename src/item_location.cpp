@@ -551,17 +551,14 @@ class item_location::impl::item_in_container : public item_location::impl
         }
 
         item *unpack( int idx ) const override {
-            if( idx < 0 || static_cast<size_t>( idx ) >= target()->contents.num_item_stacks() ) {
+            // Same order as calc_index(); asking target() here would recurse into unpacking
+            if( idx < 0 || static_cast<size_t>( idx ) >= container->contents.num_item_stacks() ) {
                 return nullptr;
             }
-            std::list<const item *> all_items = container->contents.all_items_ptr();
+            std::list<const item *> all_items = container->contents.all_items_top();
             auto iter = all_items.begin();
             std::advance( iter, idx );
-            if( iter != all_items.end() ) {
-                return const_cast<item *>( *iter );
-            } else {
-                return nullptr;
-            }
+            return const_cast<item *>( *iter );
         }
 
         std::string describe( const Character * ) const override {
@@ -0,0 +1,279 @@
+#include "item_var_map.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iterator>
+#include <unordered_map>
+
+#include "json.h"
+#include "string_formatter.h"
+#include "string_utils.h"
+
+static std::vector<std::string> &var_names()
+{
+    static std::vector<std::string> names;
+    return names;
+}
+
+static std::unordered_map<std::string, uint32_t> &var_name_ids()
+{
+    static std::unordered_map<std::string, uint32_t> ids;
+    return ids;
+}
+
+static uint32_t intern_var_name( const std::string &name )
+{
+    const auto iter = var_name_ids().emplace( name, static_cast<uint32_t>( var_names().size() ) );
+    if( iter.second ) {
+        var_names().push_back( name );
+    }
+    return iter.first->second;
+}
+
+const std::string &item_var_map::name_of( const uint32_t id )
+{
+    return var_names()[id];
+}
+
+const item_var_map::entry *item_var_map::find( const std::string &name ) const
+{
+    const auto iter = var_name_ids().find( name );
+    if( iter == var_name_ids().end() ) {
+        return nullptr;
+    }
+    const uint32_t id = iter->second;
+    const auto it = std::lower_bound( entries.begin(), entries.end(), id,
+    []( const entry & e, const uint32_t key ) {
+        return e.name < key;
+    } );
+    return it != entries.end() && it->name == id ? &*it : nullptr;
+}
+
+item_var_map::entry &item_var_map::find_or_add( const std::string &name )
+{
+    const uint32_t id = intern_var_name( name );
+    auto it = std::lower_bound( entries.begin(), entries.end(), id,
+    []( const entry & e, const uint32_t key ) {
+        return e.name < key;
+    } );
+    if( it == entries.end() || it->name != id ) {
+        it = entries.emplace( it );
+        it->name = id;
+    }
+    return *it;
+}
+
+static std::string format_real( const double value )
+{
+    return string_format( "%f", value );
+}
+
+static std::string format_point( const int x, const int y, const int z )
+{
+    return string_format( "%d,%d,%d", x, y, z );
+}
+
+/** Parses @p s as an integer, but only if @p s is how that integer is printed. */
+static bool parse_canonical_integer( const std::string &s, long long &value )
+{
+    if( s.empty() || s.size() > 20 ) {
+        return false;
+    }
+    char *end = nullptr;
+    value = std::strtoll( s.c_str(), &end, 10 );
+    return *end == '\0' && std::to_string( value ) == s;
+}
+
+/** Parses @p s as a tripoint, but only if @p s is how that tripoint is printed. */
+static bool parse_canonical_point( const std::string &s, int ( &value )[3] )
+{
+    if( std::count( s.begin(), s.end(), ',' ) != 2 ) {
+        return false;
+    }
+    const char *pos = s.c_str();
+    for( int &v : value ) {
+        char *end = nullptr;
+        v = static_cast<int>( std::strtol( pos, &end, 10 ) );
+        pos = end + 1;
+    }
+    return format_point( value[0], value[1], value[2] ) == s;
+}
+
+/** Parses @p s as a real, but only if @p s is how that real is printed. */
+static bool parse_canonical_real( const std::string &s, double &value )
+{
+    if( s.find( '.' ) == std::string::npos ) {
+        return false;
+    }
+    char *end = nullptr;
+    value = std::strtod( s.c_str(), &end );
+    return *end == '\0' && std::isfinite( value ) && format_real( value ) == s;
+}
+
+std::string item_var_map::entry::str() const
+{
+    switch( type ) {
+        case value_type::integer:
+            return std::to_string( integer );
+        case value_type::real:
+            return format_real( real );
+        case value_type::point:
+            return format_point( point[0], point[1], point[2] );
+        case value_type::text:
+            break;
+    }
+    return text;
+}
+
+bool item_var_map::entry::operator==( const entry &rhs ) const
+{
+    if( name != rhs.name || type != rhs.type ) {
+        return false;
+    }
+    switch( type ) {
+        case value_type::integer:
+            return integer == rhs.integer;
+        case value_type::real:
+            // 0.0 and -0.0 print differently
+            return real == rhs.real && std::signbit( real ) == std::signbit( rhs.real );
+        case value_type::point:
+            return std::equal( std::begin( point ), std::end( point ), std::begin( rhs.point ) );
+        case value_type::text:
+            break;
+    }
+    return text == rhs.text;
+}
+
+void item_var_map::set( const std::string &name, const long long value )
+{
+    entry &e = find_or_add( name );
+    e.type = value_type::integer;
+    e.integer = value;
+    e.text.clear();
+}
+
+void item_var_map::set( const std::string &name, const double value )
+{
+    // Keep exactly the value the saved string will load as
+    const std::string s = format_real( value );
+    double parsed = 0;
+    if( !parse_canonical_real( s, parsed ) ) {
+        set( name, s );
+        return;
+    }
+    entry &e = find_or_add( name );
+    e.type = value_type::real;
+    e.real = parsed;
+    e.text.clear();
+}
+
+void item_var_map::set( const std::string &name, const tripoint &value )
+{
+    entry &e = find_or_add( name );
+    e.type = value_type::point;
+    e.point[0] = value.x;
+    e.point[1] = value.y;
+    e.point[2] = value.z;
+    e.text.clear();
+}
+
+void item_var_map::set( const std::string &name, const std::string &value )
+{
+    entry &e = find_or_add( name );
+    if( parse_canonical_integer( value, e.integer ) ) {
+        e.type = value_type::integer;
+    } else if( parse_canonical_point( value, e.point ) ) {
+        e.type = value_type::point;
+    } else if( parse_canonical_real( value, e.real ) ) {
+        e.type = value_type::real;
+    } else {
+        e.type = value_type::text;
+        e.text = value;
+        return;
+    }
+    e.text.clear();
+}
+
+double item_var_map::get( const std::string &name, const double default_value ) const
+{
+    const entry *e = find( name );
+    if( e == nullptr ) {
+        return default_value;
+    }
+    switch( e->type ) {
+        case value_type::integer:
+            return static_cast<double>( e->integer );
+        case value_type::real:
+            return e->real;
+        case value_type::point:
+            return e->point[0];
+        case value_type::text:
+            break;
+    }
+    return atof( e->text.c_str() );
+}
+
+tripoint item_var_map::get( const std::string &name, const tripoint &default_value ) const
+{
+    const entry *e = find( name );
+    if( e == nullptr ) {
+        return default_value;
+    }
+    if( e->type == value_type::point ) {
+        return tripoint( e->point[0], e->point[1], e->point[2] );
+    }
+    std::vector<std::string> values = string_split( e->str(), ',' );
+    values.resize( 3 );
+    return tripoint( atoi( values[0].c_str() ),
+                     atoi( values[1].c_str() ),
+                     atoi( values[2].c_str() ) );
+}
+
+std::string item_var_map::get( const std::string &name, const std::string &default_value ) const
+{
+    const entry *e = find( name );
+    return e == nullptr ? default_value : e->str();
+}
+
+bool item_var_map::contains( const std::string &name ) const
+{
+    return find( name ) != nullptr;
+}
+
+void item_var_map::erase( const std::string &name )
+{
+    const entry *e = find( name );
+    if( e != nullptr ) {
+        entries.erase( entries.begin() + ( e - entries.data() ) );
+    }
+}
+
+std::map<std::string, std::string> item_var_map::to_map() const
+{
+    std::map<std::string, std::string> result;
+    for( const entry &e : entries ) {
+        result.emplace( name_of( e.name ), e.str() );
+    }
+    return result;
+}
+
+void item_var_map::serialize( JsonOut &jsout ) const
+{
+    jsout.write( to_map() );
+}
+
+void item_var_map::deserialize( JsonIn &jsin )
+{
+    clear();
+    jsin.start_object();
+    while( !jsin.end_object() ) {
+        const std::string name = jsin.get_member_name();
+        set( name, jsin.get_string() );
+    }
+}
+
+bool item_var_map::operator==( const item_var_map &rhs ) const
+{
+    return entries == rhs.entries;
+}
@@ -0,0 +1,110 @@
+#pragma once
+#ifndef CATA_SRC_ITEM_VAR_MAP_H
+#define CATA_SRC_ITEM_VAR_MAP_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "point.h"
+
+class JsonIn;
+class JsonOut;
+
+/**
+ * Storage behind the item variables (@ref item::set_var and friends).
+ *
+ * Variable names are interned into a global table, and each value is kept as an integer,
+ * a floating point number, a tripoint or a string, whichever of them prints back to exactly
+ * the string the value stands for. Numeric variables are therefore not parsed on every read,
+ * while two maps still compare equal exactly when their string forms do, and they save and
+ * load as the plain string-to-string JSON object used before.
+ *
+ * Entries live in a vector sorted by name id, which stays empty (and free to copy) for
+ * most items.
+ */
+class item_var_map
+{
+    public:
+        bool empty() const {
+            return entries.empty();
+        }
+        size_t size() const {
+            return entries.size();
+        }
+        void clear() {
+            entries.clear();
+        }
+
+        void set( const std::string &name, long long value );
+        void set( const std::string &name, double value );
+        void set( const std::string &name, const tripoint &value );
+        void set( const std::string &name, const std::string &value );
+
+        double get( const std::string &name, double default_value ) const;
+        tripoint get( const std::string &name, const tripoint &default_value ) const;
+        std::string get( const std::string &name, const std::string &default_value ) const;
+
+        bool contains( const std::string &name ) const;
+        void erase( const std::string &name );
+        /** Erases all variables whose name matches the predicate. */
+        template<typename Predicate>
+        void erase_if( Predicate pred );
+
+        /** All variables as strings, ordered by name. */
+        std::map<std::string, std::string> to_map() const;
+
+        void serialize( JsonOut &jsout ) const;
+        void deserialize( JsonIn &jsin );
+
+        bool operator==( const item_var_map &rhs ) const;
+        bool operator!=( const item_var_map &rhs ) const {
+            return !( *this == rhs );
+        }
+
+    private:
+        enum class value_type : uint8_t {
+            integer,
+            real,
+            point,
+            text,
+        };
+
+        struct entry {
+            uint32_t name;
+            value_type type;
+            union {
+                long long integer;
+                double real;
+                int point[3];
+            };
+            /** Only used by value_type::text. */
+            std::string text;
+
+            std::string str() const;
+            bool operator==( const entry &rhs ) const;
+        };
+
+        std::vector<entry> entries;
+
+        static const std::string &name_of( uint32_t id );
+        /** Entry with the given name, nullptr if not set. */
+        const entry *find( const std::string &name ) const;
+        /** Entry with the given name, created (with unspecified contents) if not set. */
+        entry &find_or_add( const std::string &name );
+};
+
+template<typename Predicate>
+void item_var_map::erase_if( Predicate pred )
+{
+    for( auto it = entries.begin(); it != entries.end(); ) {
+        if( pred( name_of( it->name ) ) ) {
+            it = entries.erase( it );
+        } else {
+            ++it;
+        }
+    }
+}
+
+#endif // CATA_SRC_ITEM_VAR_MAP_H
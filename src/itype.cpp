@@ -3,6 +3,7 @@
 #include <cstdlib>
 
 #include "debug.h"
+#include "flag.h"
 #include "item.h"
 #include "player.h"
 #include "ret_val.h"
@@ -70,12 +71,36 @@ bool itype::has_use() const
 
 bool itype::has_flag( const std::string &flag ) const
 {
-    return item_tags.count( flag );
+    return has_flag( flag_str_id( flag ) );
 }
 
 bool itype::has_flag( const flag_str_id &flag ) const
 {
-    return item_tags.count( flag.str() );
+    if( flag_bits.empty() ) {
+        return item_tags.count( flag.str() );
+    }
+    // Undefined flags are never in item_tags of a finalized type
+    return flag.is_valid() && has_flag( flag.id() );
+}
+
+bool itype::has_flag( const flag_id &flag ) const
+{
+    if( flag_bits.empty() ) {
+        return item_tags.count( flag.id().str() );
+    }
+    const size_t i = static_cast<size_t>( flag.to_i() );
+    return i < flag_bits.size() && flag_bits[i];
+}
+
+void itype::cache_flags()
+{
+    flag_bits.assign( json_flag::get_all().size(), false );
+    for( const std::string &f : item_tags ) {
+        const flag_str_id id( f );
+        if( id.is_valid() ) {
+            flag_bits[id.id().to_i()] = true;
+        }
+    }
 }
 
 const itype::FlagsSetType &itype::get_flags() const
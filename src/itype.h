@@ -1041,6 +1041,12 @@ struct itype {
 
         FlagsSetType item_tags;
 
+        /**
+         * @ref item_tags indexed by @ref flag_id, filled in by @ref cache_flags once the
+         * type is finalized. Empty until then, in which case lookups use @ref item_tags.
+         */
+        std::vector<bool> flag_bits;
+
         std::string get_item_type_string() const {
             if( tool ) {
                 return "TOOL";
@@ -1117,6 +1123,10 @@ struct itype {
         // TODO: Remove the string version
         bool has_flag( const std::string &flag ) const;
         bool has_flag( const flag_str_id &flag ) const;
+        bool has_flag( const flag_id &flag ) const;
+
+        /** Rebuilds @ref flag_bits from @ref item_tags, must be called after the latter changes */
+        void cache_flags();
 
         // returns read-only set of all item tags/flags
         const FlagsSetType &get_flags() const;
@@ -187,11 +187,26 @@ map::map( int mapsize, bool zlev )
 
     dbg( DL::Info ) << "map::map(): my_MAPSIZE: " << my_MAPSIZE << " z-levels enabled:" << zlevels;
     traplocs.resize( trap::count() );
+    bump_contents_revision();
+    bump_charges_revision();
 }
 
 map::~map() = default;
 map &map::operator=( map && ) = default;
 
+/** Shared by all maps, so that a replaced map never repeats a revision of the old one */
+static int last_map_revision = 0;
+
+void map::bump_contents_revision()
+{
+    contents_revision = ++last_map_revision;
+}
+
+void map::bump_charges_revision()
+{
+    charges_revision = ++last_map_revision;
+}
+
 static submap null_submap;
 
 maptile map::maptile_at( const tripoint &p ) const
@@ -277,15 +292,20 @@ void map::add_vehicle_to_cache( vehicle *veh )
             continue;
         }
         const tripoint p = veh->global_part_pos3( vpr.part() );
+        if( !inbounds( p ) ) {
+            continue;
+        }
         level_cache &ch = get_cache( p.z );
         ch.veh_in_active_range = true;
-        ch.veh_cached_parts[p] = std::make_pair( veh,  static_cast<int>( vpr.part_index() ) );
-        if( inbounds( p ) ) {
-            ch.veh_exists_at[p.x][p.y] = true;
+        std::pair<vehicle *, int> &part = ch.veh_cached_parts[p.x][p.y];
+        if( part.first == nullptr ) {
+            ch.veh_cached_part_count++;
         }
+        part = std::make_pair( veh, static_cast<int>( vpr.part_index() ) );
     }
 
     last_full_vehicle_list_dirty = true;
+    bump_contents_revision();
 }
 
 void map::clear_vehicle_point_from_cache( vehicle *veh, const tripoint &pt )
@@ -295,15 +315,15 @@ void map::clear_vehicle_point_from_cache( vehicle *veh, const tripoint &pt )
         return;
     }
 
-    level_cache &ch = get_cache( pt.z );
     if( inbounds( pt ) ) {
-        ch.veh_exists_at[pt.x][pt.y] = false;
-    }
-    auto it = ch.veh_cached_parts.find( pt );
-    if( it != ch.veh_cached_parts.end() && it->second.first == veh ) {
-        ch.veh_cached_parts.erase( it );
+        level_cache &ch = get_cache( pt.z );
+        std::pair<vehicle *, int> &part = ch.veh_cached_parts[pt.x][pt.y];
+        if( part.first == veh ) {
+            part = std::make_pair( nullptr, -1 );
+            ch.veh_cached_part_count--;
+        }
     }
-
+    bump_contents_revision();
 }
 
 void map::clear_vehicle_cache( )
@@ -312,16 +332,13 @@ void map::clear_vehicle_cache( )
     const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int zlev = zmin; zlev <= zmax; zlev++ ) {
         level_cache &ch = get_cache( zlev );
-        while( !ch.veh_cached_parts.empty() ) {
-            const auto part = ch.veh_cached_parts.begin();
-            const auto &p = part->first;
-            if( inbounds( p ) ) {
-                ch.veh_exists_at[p.x][p.y] = false;
-            }
-            ch.veh_cached_parts.erase( part );
+        // Levels that never had a vehicle in range have nothing to clear
+        if( ch.veh_in_active_range ) {
+            ch.clear_veh_cached_parts();
         }
         ch.veh_in_active_range = false;
     }
+    bump_contents_revision();
 }
 
 void map::clear_vehicle_list( const int zlev )
@@ -493,13 +510,7 @@ bool map::vehproceed( VehicleList &vehicle_list )
         level_cache &cache = get_cache( zlev );
 
         // Check if any vehicles exist in the active range for this z-level
-        cache.veh_in_active_range = cache.veh_in_active_range &&
-                                    std::any_of( std::begin( cache.veh_exists_at ),
-        std::end( cache.veh_exists_at ), []( const auto & row ) {
-            return std::any_of( std::begin( row ), std::end( row ), []( bool veh_exists ) {
-                return veh_exists;
-            } );
-        } );
+        cache.veh_in_active_range = cache.veh_in_active_range && cache.veh_cached_part_count > 0;
     }
 
     return true;
@@ -1020,20 +1031,14 @@ const vehicle *map::veh_at_internal( const tripoint &p, int &part_num ) const
 {
     // This function is called A LOT. Move as much out of here as possible.
     const level_cache &ch = get_cache( p.z );
-    if( !ch.veh_in_active_range || !ch.veh_exists_at[p.x][p.y] ) {
+    if( !ch.veh_in_active_range ) {
         part_num = -1;
         return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
     }
 
-    const auto it = ch.veh_cached_parts.find( p );
-    if( it != ch.veh_cached_parts.end() ) {
-        part_num = it->second.second;
-        return it->second.first;
-    }
-
-    debugmsg( "vehicle part cache indicated vehicle not found: %d %d %d", p.x, p.y, p.z );
-    part_num = -1;
-    return nullptr;
+    const std::pair<vehicle *, int> &part = ch.veh_cached_parts[p.x][p.y];
+    part_num = part.second;
+    return part.first;
 }
 
 vehicle *map::veh_at_internal( const tripoint &p, int &part_num )
@@ -1368,6 +1373,7 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture,
     }
 
     current_submap->set_furn( l, new_furniture );
+    bump_contents_revision();
 
     // Set the dirty flags
     const furn_t &old_t = old_id.obj();
@@ -1646,6 +1652,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
     }
 
     current_submap->set_ter( l, new_terrain );
+    bump_contents_revision();
 
     // Set the dirty flags
     const ter_t &old_t = old_id.obj();
@@ -4091,6 +4098,7 @@ map_stack::iterator map::i_rem( const tripoint &p, map_stack::const_iterator it
     }
 
     current_submap->update_lum_rem( l, *it );
+    bump_contents_revision();
 
     return current_submap->get_items( l ).erase( it );
 }
@@ -4119,6 +4127,7 @@ void map::i_clear( const tripoint &p )
 
     current_submap->set_lum( l, 0 );
     current_submap->get_items( l ).clear();
+    bump_contents_revision();
 }
 
 item &map::spawn_an_item( const tripoint &p, item new_item,
@@ -4350,6 +4359,7 @@ item &map::add_item( const tripoint &p, item new_item )
     invalidate_max_populated_zlev( p.z );
 
     current_submap->update_lum_add( l, new_item );
+    bump_contents_revision();
 
     const map_stack::iterator new_pos = current_submap->get_items( l ).insert( new_item );
     if( new_item.needs_processing() ) {
@@ -4897,6 +4907,8 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
                                   const std::function<bool( const item & )> &filter, basecamp *bcp )
 {
     std::list<item> ret;
+    // Charges may be taken from items in place
+    bump_contents_revision();
 
     // populate a grid of spots that can be reached
     std::vector<tripoint> reachable_pts;
@@ -5407,6 +5419,8 @@ bool map::add_field( const tripoint &p, const field_type_id &type_id, int intens
     invalidate_max_populated_zlev( p.z );
 
     if( current_submap->get_field( l ).add_field( type_id, intensity, age ) ) {
+        // A new field can be a pseudo tool (fire), stronger or older ones change nothing there
+        bump_contents_revision();
         //Only adding it to the count if it doesn't exist.
         if( !current_submap->field_count++ ) {
             get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -5450,6 +5464,7 @@ void map::remove_field( const tripoint &p, const field_type_id &field_to_remove
     submap *const current_submap = get_submap_at( p, l );
 
     if( current_submap->get_field( l ).remove_field( field_to_remove ) ) {
+        bump_contents_revision();
         // Only adjust the count if the field actually existed.
         if( !--current_submap->field_count ) {
             get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -6122,9 +6137,15 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         min.x << 16 | min.y << 8 | ( min.z + OVERMAP_DEPTH ),
         max.x << 16 | max.y << 8 | ( max.z + OVERMAP_DEPTH )
     );
-    char cached = skew_vision_cache.get( key, -1 );
-    if( cached >= 0 ) {
-        return cached > 0;
+    // Lines with non-default slope are only probed by find_clear_path, don't cache them.
+    const bool use_cache = bresenham_slope == 0;
+    if( use_cache ) {
+        char cached = skew_vision_cache.get( key, -1 );
+        if( cached >= 0 ) {
+            skew_vision_cache_stats.hits++;
+            return cached > 0;
+        }
+        skew_vision_cache_stats.misses++;
     }
 
     bool visible = true;
@@ -6143,7 +6164,9 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
             }
             return true;
         } );
-        skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        if( use_cache ) {
+            skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        }
         return visible;
     }
 
@@ -6176,7 +6199,9 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         last_point = new_point;
         return true;
     } );
-    skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+    if( use_cache ) {
+        skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+    }
     return visible;
 }
 
@@ -6659,6 +6684,7 @@ void map::shift( const point &sp )
     const tripoint abs = get_abs_sub();
 
     set_abs_sub( abs + sp );
+    bump_contents_revision();
 
     // if player is in vehicle, (s)he must be shifted with vehicle too
     if( g->u.in_vehicle ) {
@@ -6857,6 +6883,7 @@ void map::loadn( const tripoint &grid, const bool update_vehicles )
 
     const int old_abs_z = abs_sub.z; // Ugly, but necessary at the moment
     abs_sub.z = grid.z;
+    bump_contents_revision();
 
     submap *tmpsub = MAPBUFFER.lookup_submap( grid_abs_sub );
     if( tmpsub == nullptr ) {
@@ -8036,13 +8063,17 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
+    // line of sight between any two points may have changed, not only the player's view
+    bool sight_cache_dirty = false;
     for( int z = minz; z <= maxz; z++ ) {
         // trigger FOV recalculation only when there is a change on the player's level or if fov_3d is enabled
         const bool affects_seen_cache =  z == zlev || fov_3d;
         build_outside_cache( z );
-        build_transparency_cache( z );
+        sight_cache_dirty |= build_transparency_cache( z );
         update_suspension_cache( z );
-        seen_cache_dirty |= ( build_floor_cache( z ) && affects_seen_cache );
+        const bool floor_cache_dirty = build_floor_cache( z );
+        sight_cache_dirty |= floor_cache_dirty;
+        seen_cache_dirty |= ( floor_cache_dirty && affects_seen_cache );
         seen_cache_dirty |= get_cache( z ).seen_cache_dirty && affects_seen_cache;
     }
     // needs a separate pass as it changes the caches on neighbour z-levels (e.g. floor_cache);
@@ -8053,7 +8084,7 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
 
     seen_cache_dirty |= build_vision_transparency_cache( zlev );
 
-    if( seen_cache_dirty ) {
+    if( seen_cache_dirty || sight_cache_dirty ) {
         skew_vision_cache.clear();
     }
     // Initial value is illegal player position.
@@ -8557,7 +8588,14 @@ level_cache::level_cache()
     std::fill_n( &camera_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &visibility_cache[0][0], map_dimensions, lit_level::DARK );
     veh_in_active_range = false;
-    std::fill_n( &veh_exists_at[0][0], map_dimensions, false );
+    clear_veh_cached_parts();
+}
+
+void level_cache::clear_veh_cached_parts()
+{
+    std::fill_n( &veh_cached_parts[0][0], MAPSIZE_X * MAPSIZE_Y,
+                 std::pair<vehicle *, int>( nullptr, -1 ) );
+    veh_cached_part_count = 0;
 }
 
 pathfinding_cache::pathfinding_cache()
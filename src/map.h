@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_MAP_H
 #define CATA_SRC_MAP_H
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <climits>
@@ -293,6 +294,9 @@ struct level_cache {
     level_cache();
     level_cache( const level_cache &other ) = default;
 
+    // Forgets every vehicle part in veh_cached_parts
+    void clear_veh_cached_parts();
+
     std::bitset<MAPSIZE *MAPSIZE> transparency_cache_dirty;
     bool outside_cache_dirty = false;
     bool floor_cache_dirty = false;
@@ -340,8 +344,10 @@ struct level_cache {
     std::bitset<MAPSIZE *MAPSIZE> field_cache;
 
     bool veh_in_active_range;
-    bool veh_exists_at[MAPSIZE_X][MAPSIZE_Y];
-    std::map< tripoint, std::pair<vehicle *, int> > veh_cached_parts;
+    // vehicle and part index occupying each tile, vehicle is nullptr where there is none
+    std::pair<vehicle *, int> veh_cached_parts[MAPSIZE_X][MAPSIZE_Y];
+    // number of tiles in veh_cached_parts that hold a part
+    int veh_cached_part_count = 0;
     std::set<vehicle *> vehicle_list;
     std::set<vehicle *> zone_vehicles;
 
@@ -448,6 +454,41 @@ class map
         void set_pathfinding_cache_dirty( int zlev );
         /*@}*/
 
+        /**
+         * Whether any cache lighting and visibility are derived from is dirty
+         * on a z-level in range, i.e. whether @ref build_map_cache would rebuild something.
+         */
+        bool has_dirty_vision_caches( int minz, int maxz ) const {
+            for( int z = std::max( minz, -OVERMAP_DEPTH ); z <= std::min( maxz, OVERMAP_HEIGHT ); z++ ) {
+                const level_cache &ch = get_cache_ref( z );
+                if( ch.transparency_cache_dirty.any() || ch.seen_cache_dirty ||
+                    ch.outside_cache_dirty || ch.floor_cache_dirty ) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Revision of the map contents nearby inventories are formed from:
+         * items, terrain, furniture, fields, vehicles and their cargo.
+         * Bumped on every such change, so that caches (e.g. the crafting inventory)
+         * can compare a stored value instead of being rebuilt on every call.
+         */
+        int get_contents_revision() const {
+            return contents_revision;
+        }
+        void bump_contents_revision();
+        /**
+         * Revision of the charges stored in vehicle batteries and tanks and in grids.
+         * Kept apart from @ref get_contents_revision because they change nearly every
+         * turn, while caches that only show items need not be rebuilt for that.
+         */
+        int get_charges_revision() const {
+            return charges_revision;
+        }
+        void bump_charges_revision();
+
         void set_memory_seen_cache_dirty( const tripoint &p ) {
             const int offset = p.x + p.y * MAPSIZE_Y;
             if( offset >= 0 && offset < MAPSIZE_X * MAPSIZE_Y ) {
@@ -656,6 +697,20 @@ class map
         * Returns whether `F` sees `T` with a view range of `range`.
         */
         bool sees( const tripoint &F, const tripoint &T, int range ) const;
+        /**
+         * Hit and miss counts of the line of sight cache used by @ref sees.
+         * Collected for debugging purposes only.
+         */
+        struct sight_cache_stats {
+            int hits = 0;
+            int misses = 0;
+        };
+        const sight_cache_stats &get_sight_cache_stats() const {
+            return skew_vision_cache_stats;
+        }
+        void reset_sight_cache_stats() {
+            skew_vision_cache_stats = sight_cache_stats();
+        }
     private:
         /**
          * Don't expose the slope adjust outside map functions.
@@ -1984,8 +2039,16 @@ class map
 
         /**
          * Cache of coordinate pairs recently checked for visibility.
+         * Only straight (zero slope) lines are cached.
+         * Cleared whenever the transparency or floor cache of any z-level is rebuilt.
          */
         mutable lru_cache<point, char> skew_vision_cache;
+        mutable sight_cache_stats skew_vision_cache_stats;
+
+        /** @see map::get_contents_revision */
+        int contents_revision = 0;
+        /** @see map::get_charges_revision */
+        int charges_revision = 0;
 
         /**
          * Vehicle list doesn't change often, but is pretty expensive.
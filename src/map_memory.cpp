@@ -1,5 +1,7 @@
 #include "map_memory.h"
 
+#include <map>
+
 #include "coordinate_conversions.h"
 #include "cuboid_rectangle.h"
 #include "debug.h"
@@ -12,6 +14,22 @@
 const memorized_terrain_tile mm_submap::default_tile{ "", 0, 0 };
 const int mm_submap::default_symbol = 0;
 
+constexpr int mm_submap::subtile_bits;
+constexpr int mm_submap::rotation_bits;
+
+/** Interned tile names, index is the tile id. */
+static std::vector<std::string> &mm_tile_names()
+{
+    static std::vector<std::string> names{ std::string() };
+    return names;
+}
+
+static std::unordered_map<std::string, uint32_t> &mm_tile_ids()
+{
+    static std::unordered_map<std::string, uint32_t> ids{ { std::string(), 0 } };
+    return ids;
+}
+
 #define MM_SIZE (MAPSIZE * 2)
 
 #define dbg(x) DebugLog((x),DC::MapMem)
@@ -47,6 +65,48 @@ struct reg_coord_pair {
 mm_submap::mm_submap() = default;
 mm_submap::mm_submap( bool make_valid ) : valid( make_valid ) {}
 
+uint32_t mm_submap::tile_id( const std::string &name )
+{
+    static constexpr uint32_t max_ids = 1u << ( 32 - subtile_bits - rotation_bits );
+    std::unordered_map<std::string, uint32_t> &ids = mm_tile_ids();
+    const auto it = ids.find( name );
+    if( it != ids.end() ) {
+        return it->second;
+    }
+    std::vector<std::string> &names = mm_tile_names();
+    if( names.size() >= max_ids ) {
+        debugmsg( "Too many distinct memorized tiles, can't memorize %s", name );
+        return 0;
+    }
+    const uint32_t id = names.size();
+    names.push_back( name );
+    ids.emplace( name, id );
+    return id;
+}
+
+const std::string &mm_submap::tile_name( uint32_t id )
+{
+    const std::vector<std::string> &names = mm_tile_names();
+    return id < names.size() ? names[id] : names[0];
+}
+
+uint32_t mm_submap::pack_id( uint32_t id, int subtile, int rotation )
+{
+    const uint32_t sub = static_cast<uint32_t>( subtile ) & ( ( 1u << subtile_bits ) - 1 );
+    // Vehicle parts are memorized with their facing in degrees, other tiles with 0-3
+    const uint32_t rot = static_cast<uint32_t>( ( rotation % 360 + 360 ) % 360 );
+    return ( id << ( subtile_bits + rotation_bits ) ) | ( sub << rotation_bits ) | rot;
+}
+
+memorized_terrain_tile mm_submap::unpack( uint32_t packed )
+{
+    return memorized_terrain_tile{
+        tile_name( packed_id( packed ) ),
+        static_cast<int>( ( packed >> rotation_bits ) & ( ( 1u << subtile_bits ) - 1 ) ),
+        static_cast<int>( packed & ( ( 1u << rotation_bits ) - 1 ) )
+    };
+}
+
 mm_region::mm_region() : submaps {{ nullptr }} {}
 
 bool mm_region::is_empty() const
@@ -71,7 +131,7 @@ map_memory::map_memory()
     clear_cache();
 }
 
-const memorized_terrain_tile &map_memory::get_tile( const tripoint &pos ) const
+memorized_terrain_tile map_memory::get_tile( const tripoint &pos ) const
 {
     coord_pair p( pos );
     const mm_submap &sm = get_submap( p.sm );
@@ -86,7 +146,7 @@ void map_memory::memorize_tile( const tripoint &pos, const std::string &ter,
     if( !sm.is_valid() ) {
         return;
     }
-    sm.set_tile( p.loc, memorized_terrain_tile{ ter, subtile, rotation } );
+    sm.set_packed_tile( p.loc, mm_submap::pack( ter, subtile, rotation ) );
 }
 
 int map_memory::get_symbol( const tripoint &pos ) const
@@ -114,7 +174,7 @@ void map_memory::clear_memorized_tile( const tripoint &pos )
         return;
     }
     sm.set_symbol( p.loc, mm_submap::default_symbol );
-    sm.set_tile( p.loc, mm_submap::default_tile );
+    sm.set_packed_tile( p.loc, 0 );
 }
 
 bool map_memory::prepare_region( const tripoint &p1, const tripoint &p2 )
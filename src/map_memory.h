@@ -2,8 +2,10 @@
 #ifndef CATA_SRC_MAP_MEMORY_H
 #define CATA_SRC_MAP_MEMORY_H
 
-#include <map>
+#include <cstdint>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "game_constants.h"
 #include "memory_fast.h"
@@ -26,7 +28,11 @@ struct memorized_terrain_tile {
     }
 };
 
-/** Represent a submap-sized chunk of tile memory. */
+/**
+ * Represent a submap-sized chunk of tile memory.
+ * Tiles are stored packed: the tile name is interned into a session-wide id,
+ * and the id, subtile and rotation share a single 32-bit value.
+ */
 struct mm_submap {
     public:
         static const memorized_terrain_tile default_tile;
@@ -45,21 +51,16 @@ struct mm_submap {
             return valid;
         }
 
-        inline const memorized_terrain_tile &tile( const point &p ) const {
+        inline memorized_terrain_tile tile( const point &p ) const {
             if( tiles.empty() ) {
                 return default_tile;
             } else {
-                return tiles[p.y * SEEX + p.x];
+                return unpack( tiles[p.y * SEEX + p.x] );
             }
         }
 
         inline void set_tile( const point &p, const memorized_terrain_tile &value ) {
-            if( tiles.empty() ) {
-                // call 'reserve' first to force allocation of exact size
-                tiles.reserve( SEEX * SEEY );
-                tiles.resize( SEEX * SEEY, default_tile );
-            }
-            tiles[p.y * SEEX + p.x] = value;
+            set_packed_tile( p, pack( value ) );
         }
 
         inline int symbol( const point &p ) const {
@@ -79,11 +80,58 @@ struct mm_submap {
             symbols[p.y * SEEX + p.x] = value;
         }
 
-        void serialize( JsonOut &jsout ) const;
-        void deserialize( JsonIn &jsin );
+        /**
+         * Packed tile value, see @ref pack. Packed values are only meaningful
+         * within the current session, as tile ids are not stable across sessions.
+         */
+        inline uint32_t packed_tile( const point &p ) const {
+            return tiles.empty() ? 0 : tiles[p.y * SEEX + p.x];
+        }
+
+        inline void set_packed_tile( const point &p, uint32_t value ) {
+            if( tiles.empty() ) {
+                if( value == 0 ) {
+                    return;
+                }
+                // call 'reserve' first to force allocation of exact size
+                tiles.reserve( SEEX * SEEY );
+                tiles.resize( SEEX * SEEY, 0 );
+            }
+            tiles[p.y * SEEX + p.x] = value;
+        }
+
+        /** Interns tile name. Id 0 is always the empty name. */
+        static uint32_t tile_id( const std::string &name );
+        static const std::string &tile_name( uint32_t id );
+
+        static uint32_t pack_id( uint32_t id, int subtile, int rotation );
+        static uint32_t pack( const std::string &name, int subtile, int rotation ) {
+            return pack_id( tile_id( name ), subtile, rotation );
+        }
+        static uint32_t pack( const memorized_terrain_tile &tile ) {
+            return pack( tile.tile, tile.subtile, tile.rotation );
+        }
+        static memorized_terrain_tile unpack( uint32_t packed );
+        static uint32_t packed_id( uint32_t packed ) {
+            return packed >> ( subtile_bits + rotation_bits );
+        }
+
+        /**
+         * Serializes tiles as indices into a per-region name table.
+         * @param tile_indices maps interned tile ids to indices in that table.
+         */
+        void serialize( JsonOut &jsout,
+                        const std::unordered_map<uint32_t, int> &tile_indices ) const;
+        /** @param tile_ids maps indices in the per-region name table to interned tile ids. */
+        void deserialize( JsonIn &jsin, const std::vector<uint32_t> &tile_ids );
+        /** Reads the old format, which stores the tile name of each run. */
+        void deserialize_legacy( JsonIn &jsin );
 
     private:
-        std::vector<memorized_terrain_tile> tiles; // holds either 0 or SEEX*SEEY elements
+        static constexpr int subtile_bits = 3;
+        static constexpr int rotation_bits = 9;
+
+        std::vector<uint32_t> tiles; // holds either 0 or SEEX*SEEY elements
         std::vector<int> symbols; // holds either 0 or SEEX*SEEY elements
         bool valid = true;
 };
@@ -92,6 +140,7 @@ struct mm_submap {
  * Represents a square of mm_submaps.
  * For faster save/load, submaps are collected into regions
  * and each region is saved in its own file.
+ * Each tile name is written once per region, runs of tiles refer to it by index.
  */
 struct mm_region {
     shared_ptr_fast<mm_submap> submaps[MM_REG_SIZE][MM_REG_SIZE];
@@ -156,7 +205,7 @@ class map_memory
          * Returns memorized tile.
          * @param pos tile position, in global ms coords.
          */
-        const memorized_terrain_tile &get_tile( const tripoint &pos ) const;
+        memorized_terrain_tile get_tile( const tripoint &pos ) const;
 
         /**
          * Memorizes given symbol, overwriting old value.
@@ -177,7 +226,7 @@ class map_memory
         void clear_memorized_tile( const tripoint &pos );
 
     private:
-        std::map<tripoint, shared_ptr_fast<mm_submap>> submaps;
+        std::unordered_map<tripoint, shared_ptr_fast<mm_submap>> submaps;
 
         std::vector<shared_ptr_fast<mm_submap>> cached;
         tripoint cache_pos;
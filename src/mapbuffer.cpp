@@ -3,8 +3,8 @@
 #include <algorithm>
 #include <exception>
 #include <functional>
-#include <set>
 #include <sstream>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -56,13 +56,7 @@ void mapbuffer::reset()
 
 bool mapbuffer::add_submap( const tripoint &p, submap *sm )
 {
-    if( submaps.count( p ) != 0 ) {
-        return false;
-    }
-
-    submaps[p] = sm;
-
-    return true;
+    return submaps.emplace( p, sm ).second;
 }
 
 bool mapbuffer::add_submap( const tripoint &p, std::unique_ptr<submap> &sm )
@@ -85,6 +79,12 @@ void mapbuffer::remove_submap( tripoint addr )
     submaps.erase( m_target );
 }
 
+submap *mapbuffer::find_loaded_submap( const tripoint &p ) const
+{
+    const auto iter = submaps.find( p );
+    return iter == submaps.end() ? nullptr : iter->second;
+}
+
 submap *mapbuffer::lookup_submap( const tripoint &p )
 {
     const auto iter = submaps.find( p );
@@ -114,8 +114,9 @@ void mapbuffer::save( bool delete_after_save )
     static_popup popup;
 
     // A set of already-saved submaps, in global overmap coordinates.
-    std::set<tripoint> saved_submaps;
-    std::list<tripoint> submaps_to_delete;
+    std::unordered_set<tripoint> saved_submaps;
+    saved_submaps.reserve( submaps.size() / 4 + 1 );
+    std::vector<tripoint> submaps_to_delete;
     static constexpr std::chrono::milliseconds update_interval( 500 );
     auto last_update = std::chrono::steady_clock::now();
 
@@ -133,11 +134,10 @@ void mapbuffer::save( bool delete_after_save )
         // Submaps are generated in quads, so we know if we have one member of a quad,
         // we have the rest of it, if that assumption is broken we have REAL problems.
         const tripoint om_addr = sm_to_omt_copy( elem.first );
-        if( saved_submaps.count( om_addr ) != 0 ) {
+        if( !saved_submaps.insert( om_addr ).second ) {
             // Already handled this one.
             continue;
         }
-        saved_submaps.insert( om_addr );
 
         // A segment is a chunk of 32x32 submap quads.
         // We're breaking them into subdirectories so there aren't too many files per directory.
@@ -163,7 +163,7 @@ void mapbuffer::save( bool delete_after_save )
 }
 
 void mapbuffer::save_quad( const std::string &dirname, const std::string &filename,
-                           const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
+                           const tripoint &om_addr, std::vector<tripoint> &submaps_to_delete,
                            bool delete_after_save )
 {
     std::vector<point> offsets;
@@ -179,7 +179,8 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         submap_addr.x += offsets_offset.x;
         submap_addr.y += offsets_offset.y;
         submap_addrs.push_back( submap_addr );
-        submap *sm = submaps[submap_addr];
+        // Don't use operator[] here, it would insert while save() iterates over submaps
+        const submap *sm = find_loaded_submap( submap_addr );
         if( sm != nullptr && !sm->is_uniform ) {
             all_uniform = false;
         }
@@ -189,7 +190,7 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         // Nothing to save - this quad will be regenerated faster than it would be re-read
         if( delete_after_save ) {
             for( auto &submap_addr : submap_addrs ) {
-                if( submaps.count( submap_addr ) > 0 && submaps[submap_addr] != nullptr ) {
+                if( find_loaded_submap( submap_addr ) != nullptr ) {
                     submaps_to_delete.push_back( submap_addr );
                 }
             }
@@ -204,12 +205,7 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         JsonOut jsout( fout );
         jsout.start_array();
         for( auto &submap_addr : submap_addrs ) {
-            if( submaps.count( submap_addr ) == 0 ) {
-                continue;
-            }
-
-            submap *sm = submaps[submap_addr];
-
+            submap *sm = find_loaded_submap( submap_addr );
             if( sm == nullptr ) {
                 continue;
             }
@@ -264,12 +260,12 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
         // If it doesn't exist, trigger generating it.
         return nullptr;
     }
-    if( submaps.count( p ) == 0 ) {
+    submap *sm = find_loaded_submap( p );
+    if( sm == nullptr ) {
         debugmsg( "file %s did not contain the expected submap %d,%d,%d",
                   quad_path, p.x, p.y, p.z );
-        return nullptr;
     }
-    return submaps[ p ];
+    return sm;
 }
 
 void mapbuffer::deserialize( JsonIn &jsin )
@@ -2,10 +2,10 @@
 #ifndef CATA_SRC_MAPBUFFER_H
 #define CATA_SRC_MAPBUFFER_H
 
-#include <list>
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "coordinates.h"
 #include "point.h"
@@ -59,7 +59,7 @@ class mapbuffer
         }
 
     private:
-        using submap_map_t = std::map<tripoint, submap *>;
+        using submap_map_t = std::unordered_map<tripoint, submap *>;
 
     public:
         inline submap_map_t::iterator begin() {
@@ -77,10 +77,12 @@ class mapbuffer
         // There's a very good reason this is private,
         // if not handled carefully, this can erase in-use submaps and crash the game.
         void remove_submap( tripoint addr );
+        /** Like @ref lookup_submap, but never loads from disk. */
+        submap *find_loaded_submap( const tripoint &p ) const;
         submap *unserialize_submaps( const tripoint &p );
         void deserialize( JsonIn &jsin );
         void save_quad( const std::string &dirname, const std::string &filename,
-                        const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
+                        const tripoint &om_addr, std::vector<tripoint> &submaps_to_delete,
                         bool delete_after_save );
         submap_map_t submaps;
 };
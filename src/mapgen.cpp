@@ -2396,7 +2396,6 @@ bool mapgen_function_json_base::setup_common( const JsonObject &jo )
     JsonArray sparray;
     JsonObject pjo;
 
-    format.resize( static_cast<size_t>( mapgensize.x * mapgensize.y ) );
     // just like mapf::basic_bind("stuff",blargle("foo", etc) ), only json input and faster when applying
     if( jo.has_array( "rows" ) ) {
         mapgen_palette palette = mapgen_palette::load_temp( jo, "dda" );
@@ -2459,11 +2458,12 @@ bool mapgen_function_json_base::setup_common( const JsonObject &jo )
                                        "'%s' has no terrain, furniture, or other definition",
                                        c + 1, i + 1, key.str ) );
                 }
-                if( has_terrain ) {
-                    format[ calc_index( p ) ].ter = iter_ter->second;
-                }
-                if( has_furn ) {
-                    format[ calc_index( p ) ].furn = iter_furn->second;
+                if( has_terrain || has_furn ) {
+                    const ter_id ter = has_terrain ? iter_ter->second : t_null;
+                    const furn_id furn = has_furn ? iter_furn->second : f_null;
+                    if( ter != t_null || furn != f_null ) {
+                        format.push_back( { p, ter, furn } );
+                    }
                 }
                 if( has_placing ) {
                     jmapgen_place where( p );
@@ -2534,8 +2534,8 @@ void mapgen_function_json_nested::check( const std::string &oter_name ) const
 
 void mapgen_function_json_base::check_common( const std::string &oter_name ) const
 {
-    for( const ter_furn_id &id : format ) {
-        if( check_furn( id.furn, "oter " + oter_name ) ) {
+    for( const format_cell &cell : format ) {
+        if( check_furn( cell.furn, "oter " + oter_name ) ) {
             return;
         }
     }
@@ -2721,21 +2721,16 @@ bool jmapgen_setmap::has_vehicle_collision( mapgendata &dat, const point &offset
 
 void mapgen_function_json_base::formatted_set_incredibly_simple( map &m, const point &offset ) const
 {
-    for( int y = 0; y < mapgensize.y; y++ ) {
-        for( int x = 0; x < mapgensize.x; x++ ) {
-            point p( x, y );
-            const size_t index = calc_index( p );
-            const ter_furn_id &tdata = format[index];
-            const point map_pos = p + offset;
-            if( tdata.furn != f_null ) {
-                if( tdata.ter != t_null ) {
-                    m.set( map_pos, tdata.ter, tdata.furn );
-                } else {
-                    m.furn_set( map_pos, tdata.furn );
-                }
-            } else if( tdata.ter != t_null ) {
-                m.ter_set( map_pos, tdata.ter );
+    for( const format_cell &cell : format ) {
+        const point map_pos = cell.p + offset;
+        if( cell.furn != f_null ) {
+            if( cell.ter != t_null ) {
+                m.set( map_pos, cell.ter, cell.furn );
+            } else {
+                m.furn_set( map_pos, cell.furn );
             }
+        } else {
+            m.ter_set( map_pos, cell.ter );
         }
     }
 }
@@ -2743,15 +2738,9 @@ void mapgen_function_json_base::formatted_set_incredibly_simple( map &m, const p
 bool mapgen_function_json_base::has_vehicle_collision( mapgendata &dat, const point &offset ) const
 {
     if( do_format ) {
-        for( int y = 0; y < mapgensize.y; y++ ) {
-            for( int x = 0; x < mapgensize.x; x++ ) {
-                const point p( x, y );
-                const ter_furn_id &tdata = format[calc_index( p )];
-                const point map_pos = p + offset;
-                if( ( tdata.furn != f_null || tdata.ter != t_null ) &&
-                    dat.m.veh_at( tripoint( map_pos, dat.zlevel() ) ).has_value() ) {
-                    return true;
-                }
+        for( const format_cell &cell : format ) {
+            if( dat.m.veh_at( tripoint( cell.p + offset, dat.zlevel() ) ).has_value() ) {
+                return true;
             }
         }
     }
@@ -2825,7 +2814,7 @@ void mapgen_function_json_nested::nest( mapgendata &dat, const point &offset ) c
 
     objects.apply( dat, offset );
 
-    resolve_regional_terrain_and_furniture( dat );
+    // Regional terrain and furniture are resolved once by whatever the chunk is nested in
 }
 
 /*
@@ -337,7 +337,14 @@ class mapgen_function_json_base
 
         point mapgensize;
         point m_offset;
-        std::vector<ter_furn_id> format;
+        /** A tile of "rows" that sets terrain and/or furniture. */
+        struct format_cell {
+            point p;
+            ter_id ter;
+            furn_id furn;
+        };
+        /** Tiles set by "rows", resolved from the palette at load time. Tiles setting nothing are left out. */
+        std::vector<format_cell> format;
         std::vector<jmapgen_setmap> setmap_points;
 
         jmapgen_objects objects;
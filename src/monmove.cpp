@@ -819,8 +819,19 @@ void monster::move()
             const auto &pf_settings = get_pathfinding_settings();
             if( pf_settings.max_dist >= rl_dist( pos(), goal ) &&
                 ( path.empty() || rl_dist( pos(), path.front() ) >= 2 || path.back() != goal ) ) {
-                // We need a new path
-                path = g->m.route( pos(), goal, pf_settings, get_path_avoid() );
+                // A target that moved by one tile usually still sits at the end of a shortest path
+                // through its old position: extend the path instead of routing again.
+                const bool extend_path = !path.empty() && rl_dist( pos(), path.front() ) < 2 &&
+                                         path.back().z == goal.z && posz() == goal.z &&
+                                         square_dist( path.back(), goal ) == 1 &&
+                                         static_cast<int>( path.size() ) + 1 <= square_dist( pos(), goal ) &&
+                                         can_move_to( goal );
+                if( extend_path ) {
+                    path.push_back( goal );
+                } else {
+                    // We need a new path
+                    path = g->m.route( pos(), goal, pf_settings, get_path_avoid() );
+                }
             }
 
             // Try to respect old paths, even if we can't pathfind at the moment
@@ -941,10 +941,14 @@ void overmap_terrains::finalize()
     set_oter_ids();
 }
 
+// Terrain ids matching a given search, see matching_oter_ids.
+static std::map<std::pair<std::string, ot_match_type>, std::vector<oter_id>> oter_match_cache;
+
 void overmap_terrains::reset()
 {
     terrain_types.reset();
     terrains.reset();
+    oter_match_cache.clear();
 }
 
 const std::vector<oter_t> &overmap_terrains::get_all()
@@ -1237,6 +1241,7 @@ void overmap::init_layers()
                 layer[k].explored[i][j] = false;
             }
         }
+        ter_index[k].dirty = true;
     }
 }
 
@@ -1248,6 +1253,7 @@ void overmap::ter_set( const tripoint_om_omt &p, const oter_id &id )
     }
 
     layer[p.z() + OVERMAP_DEPTH].terrain[p.x()][p.y()] = id;
+    ter_index[p.z() + OVERMAP_DEPTH].dirty = true;
 }
 
 const oter_id &overmap::ter( const tripoint_om_omt &p ) const
@@ -2105,19 +2111,67 @@ const city &overmap::get_nearest_city( const tripoint_om_omt &p ) const
     return invalid_city;
 }
 
+static const std::vector<oter_id> &matching_oter_ids( const std::string &otype,
+        ot_match_type match_type )
+{
+    const auto key = std::make_pair( otype, match_type );
+    const auto iter = oter_match_cache.find( key );
+    if( iter != oter_match_cache.end() ) {
+        return iter->second;
+    }
+    std::vector<oter_id> &ids = oter_match_cache[key];
+    for( const oter_t &ot : overmap_terrains::get_all() ) {
+        const oter_id id = ot.id.id();
+        if( is_ot_match( otype, id, match_type ) ) {
+            ids.push_back( id );
+        }
+    }
+    return ids;
+}
+
+const overmap::terrain_index &overmap::get_terrain_index( int z ) const
+{
+    terrain_index &index = ter_index[z + OVERMAP_DEPTH];
+    if( index.dirty ) {
+        index.positions.clear();
+        const map_layer &ml = layer[z + OVERMAP_DEPTH];
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                index.positions[ml.terrain[x][y]].push_back( static_cast<uint16_t>( x * OMAPY + y ) );
+            }
+        }
+        index.dirty = false;
+    }
+    return index;
+}
+
+std::vector<tripoint_om_omt> overmap::find_all_matching( const std::string &otype,
+        ot_match_type match_type, int z ) const
+{
+    std::vector<tripoint_om_omt> found;
+    if( z < -OVERMAP_DEPTH || z > OVERMAP_HEIGHT ) {
+        return found;
+    }
+    const terrain_index &index = get_terrain_index( z );
+    for( const oter_id &id : matching_oter_ids( otype, match_type ) ) {
+        const auto iter = index.positions.find( id );
+        if( iter == index.positions.end() ) {
+            continue;
+        }
+        for( const uint16_t pos : iter->second ) {
+            found.emplace_back( pos / OMAPY, pos % OMAPY, z );
+        }
+    }
+    return found;
+}
+
 tripoint_om_omt overmap::find_random_omt( const std::pair<std::string, ot_match_type> &target )
 const
 {
     std::vector<tripoint_om_omt> valid;
-    for( int i = 0; i < OMAPX; i++ ) {
-        for( int j = 0; j < OMAPY; j++ ) {
-            for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
-                tripoint_om_omt p( i, j, k );
-                if( is_ot_match( target.first, ter( p ), target.second ) ) {
-                    valid.push_back( p );
-                }
-            }
-        }
+    for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
+        const std::vector<tripoint_om_omt> found = find_all_matching( target.first, target.second, k );
+        valid.insert( valid.end(), found.begin(), found.end() );
     }
     return random_entry( valid, tripoint_om_omt( tripoint_min ) );
 }
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <climits>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <iosfwd>
@@ -214,6 +215,13 @@ class overmap
          * coordinates), or empty vector if no matching terrain is found.
          */
         std::vector<point_abs_omt> find_terrain( const std::string &term, int zlevel );
+        /**
+         * Returns the local coordinates of every terrain on z-level @p z that
+         * matches @p otype (see @ref is_ot_match), in no particular order.
+         * Backed by a per z-level index that is rebuilt lazily after @ref ter_set.
+         */
+        std::vector<tripoint_om_omt> find_all_matching( const std::string &otype,
+                ot_match_type match_type, int z ) const;
 
         void ter_set( const tripoint_om_omt &p, const oter_id &id );
         const oter_id &ter( const tripoint_om_omt &p ) const;
@@ -344,6 +352,15 @@ class overmap
         point_abs_om loc;
 
         std::array<map_layer, OVERMAP_LAYERS> layer;
+
+        // Positions of each terrain type on a z-level, stored as x * OMAPY + y.
+        struct terrain_index {
+            std::unordered_map<oter_id, std::vector<uint16_t>> positions;
+            bool dirty = true;
+        };
+        static_assert( OMAPX * OMAPY <= 65536, "terrain_index positions must fit in uint16_t" );
+        mutable std::array<terrain_index, OVERMAP_LAYERS> ter_index;
+        const terrain_index &get_terrain_index( int z ) const;
         std::unordered_map<tripoint_abs_omt, scent_trace> scents;
 
         // Records the locations where a given overmap special was placed, which
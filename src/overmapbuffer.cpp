@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cassert>
 #include <climits>
+#include <cstdlib>
 #include <iterator>
 #include <list>
 #include <map>
@@ -952,49 +953,85 @@ static omt_find_params assign_params(
     return params;
 }
 
-bool overmapbuffer::is_findable_location( const tripoint_abs_omt &location,
-        const omt_find_params &params )
-{
-    bool type_matches = false;
-    if( params.existing_only ) {
-        for( const std::pair<std::string, ot_match_type> &elem : params.types ) {
-            type_matches = check_ot_existing( elem.first, elem.second, location );
-            if( type_matches ) {
-                break;
-            }
-        }
-    } else {
-        for( const std::pair<std::string, ot_match_type> &elem : params.types ) {
-            type_matches = check_ot( elem.first, elem.second, location );
-            if( type_matches ) {
-                break;
+// An overmap that may hold results for a search, along with its closest point to the origin.
+struct overmap_search_entry {
+    point_abs_om pos;
+    int nearest_dist;
+};
+
+/**
+ * Returns the overmaps that have at least one point whose horizontal distance from
+ * @p origin lies within [@p min_dist, @p max_dist], closest first.
+ */
+static std::vector<overmap_search_entry> overmaps_in_range( const point_abs_omt &origin,
+        int min_dist, int max_dist )
+{
+    // Distance from origin to the nearest and furthest point of [lo, lo + size) along one axis.
+    const auto axis_dists = []( int o, int lo, int size ) {
+        const int hi = lo + size - 1;
+        const int nearest = std::max( { 0, lo - o, o - hi } );
+        const int furthest = std::max( std::abs( o - lo ), std::abs( o - hi ) );
+        return std::make_pair( nearest, furthest );
+    };
+
+    std::vector<overmap_search_entry> result;
+    const point_abs_om lo = project_to<coords::om>( origin - point( max_dist, max_dist ) );
+    const point_abs_om hi = project_to<coords::om>( origin + point( max_dist, max_dist ) );
+    for( int x = lo.x(); x <= hi.x(); x++ ) {
+        for( int y = lo.y(); y <= hi.y(); y++ ) {
+            const point_abs_om om_pos( x, y );
+            const point_abs_omt base = project_to<coords::omt>( om_pos );
+            const std::pair<int, int> dx = axis_dists( origin.x(), base.x(), OMAPX );
+            const std::pair<int, int> dy = axis_dists( origin.y(), base.y(), OMAPY );
+            const int nearest = std::max( dx.first, dy.first );
+            const int furthest = std::max( dx.second, dy.second );
+            if( nearest > max_dist || furthest < min_dist ) {
+                continue;
             }
+            result.push_back( { om_pos, nearest } );
         }
     }
-    if( !type_matches ) {
-        return false;
-    }
-
-    if( params.must_see && !seen( location ) ) {
-        return false;
-    }
-    if( params.cant_see && seen( location ) ) {
-        return false;
-    }
+    std::stable_sort( result.begin(), result.end(),
+    []( const overmap_search_entry & l, const overmap_search_entry & r ) {
+        return l.nearest_dist < r.nearest_dist;
+    } );
+    return result;
+}
 
-    if( params.om_special ) {
-        bool meets_om_special = false;
-        if( params.existing_only ) {
-            meets_om_special = check_overmap_special_type_existing( *params.om_special, location );
-        } else {
-            meets_om_special = check_overmap_special_type( *params.om_special, location );
+void overmapbuffer::find_in_overmap( const overmap &om, const tripoint_abs_omt &origin,
+                                     int min_z, int max_z, const omt_find_params &params,
+                                     int min_dist, int max_dist,
+                                     std::vector<tripoint_abs_omt> &result ) const
+{
+    for( int z = min_z; z <= max_z; z++ ) {
+        std::vector<tripoint_om_omt> found;
+        for( const std::pair<std::string, ot_match_type> &elem : params.types ) {
+            const std::vector<tripoint_om_omt> matches = om.find_all_matching( elem.first, elem.second, z );
+            found.insert( found.end(), matches.begin(), matches.end() );
         }
-        if( !meets_om_special ) {
-            return false;
+        if( params.types.size() > 1 ) {
+            std::sort( found.begin(), found.end() );
+            found.erase( std::unique( found.begin(), found.end() ), found.end() );
         }
-    }
 
-    return true;
+        for( const tripoint_om_omt &local : found ) {
+            const tripoint_abs_omt location = project_combine( om.pos(), local );
+            const int dist = square_dist( origin.xy(), location.xy() );
+            if( dist < min_dist || dist > max_dist ) {
+                continue;
+            }
+            if( params.must_see && !om.seen( local ) ) {
+                continue;
+            }
+            if( params.cant_see && om.seen( local ) ) {
+                continue;
+            }
+            if( params.om_special && !om.check_overmap_special_type( *params.om_special, local ) ) {
+                continue;
+            }
+            result.push_back( location );
+        }
+    }
 }
 
 tripoint_abs_omt overmapbuffer::find_closest(
@@ -1010,11 +1047,6 @@ tripoint_abs_omt overmapbuffer::find_closest(
 tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
         const omt_find_params &params )
 {
-    // Check the origin before searching adjacent tiles!
-    if( params.min_distance == 0 && is_findable_location( origin, params ) ) {
-        return origin;
-    }
-
     // By default search overmaps within a radius of 4,
     // i.e. C = current overmap, X = overmaps searched:
     // XXXXXXXXX
@@ -1034,36 +1066,33 @@ tripoint_abs_omt overmapbuffer::find_closest( const tripoint_abs_omt &origin,
     const int max_dist = params.search_range ? params.search_range : OMAPX * 5;
 
     std::vector<tripoint_abs_omt> result;
-    cata::optional<int> found_dist;
-
-    size_t num_overmaps = overmaps.size();
-    size_t counter = 0;
+    int found_dist = INT_MAX;
 
-    for( const point_abs_omt &loc_xy : closest_points_first( origin.xy(), min_dist, max_dist ) ) {
-        const int dist_xy = square_dist( origin.xy(), loc_xy );
-
-        if( found_dist && *found_dist < dist_xy ) {
+    // Overmaps are visited closest first, so once one is found the search can stop before
+    // generating overmaps that could not hold anything closer.
+    for( const overmap_search_entry &entry : overmaps_in_range( origin.xy(), min_dist, max_dist ) ) {
+        if( entry.nearest_dist > found_dist ) {
             break;
         }
+        const overmap *om = params.existing_only ? get_existing( entry.pos ) : &get( entry.pos );
+        if( params.popup ) {
+            params.popup->refresh();
+        }
+        if( om == nullptr ) {
+            continue;
+        }
 
-        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
-            const tripoint_abs_omt loc( loc_xy, z );
+        std::vector<tripoint_abs_omt> found;
+        find_in_overmap( *om, origin, -OVERMAP_DEPTH, OVERMAP_HEIGHT, params, min_dist, max_dist,
+                         found );
+        for( const tripoint_abs_omt &loc : found ) {
             const int dist = square_dist( origin, loc );
-
-            if( found_dist && *found_dist < dist ) {
-                continue;
-            }
-
-            if( is_findable_location( loc, params ) ) {
+            if( dist < found_dist ) {
                 found_dist = dist;
-                result.push_back( loc );
+                result.clear();
             }
-
-            counter += 1;
-            if( params.popup && ( num_overmaps != overmaps.size() || counter == 512 ) ) {
-                params.popup->refresh();
-                num_overmaps = overmaps.size();
-                counter = 0;
+            if( dist == found_dist ) {
+                result.push_back( loc );
             }
         }
     }
@@ -1079,22 +1108,21 @@ std::vector<tripoint_abs_omt> overmapbuffer::find_all( const tripoint_abs_omt &o
     const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX;
 
-    size_t num_overmaps = overmaps.size();
-    size_t counter = 0;
-
-    for( const tripoint_abs_omt &loc : closest_points_first( origin, min_dist, max_dist ) ) {
-        if( is_findable_location( loc, params ) ) {
-            result.push_back( loc );
-        }
-
-        counter += 1;
-        if( params.popup && ( num_overmaps != overmaps.size() || counter == 512 ) ) {
+    for( const overmap_search_entry &entry : overmaps_in_range( origin.xy(), min_dist, max_dist ) ) {
+        const overmap *om = params.existing_only ? get_existing( entry.pos ) : &get( entry.pos );
+        if( params.popup ) {
             params.popup->refresh();
-            num_overmaps = overmaps.size();
-            counter = 0;
+        }
+        if( om != nullptr ) {
+            find_in_overmap( *om, origin, origin.z(), origin.z(), params, min_dist, max_dist, result );
         }
     }
 
+    // Callers expect the closest locations first.
+    std::stable_sort( result.begin(), result.end(),
+    [&origin]( const tripoint_abs_omt & l, const tripoint_abs_omt & r ) {
+        return square_dist( origin, l ) < square_dist( origin, r );
+    } );
     return result;
 }
 
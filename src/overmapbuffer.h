@@ -522,12 +522,18 @@ class overmapbuffer
 
     private:
         /**
-         * Common function used by the find_closest/all/random to determine if the location is
-         * findable based on the specified criteria.
-         * @param location Location of search
-         * see omt_find_params for definitions of the terms
-         */
-        bool is_findable_location( const tripoint_abs_omt &location, const omt_find_params &params );
+         * Common function used by the find_closest/all/random to collect the locations of a
+         * single overmap that are findable based on the specified criteria.
+         * @param om Overmap to search, looked up through its terrain index.
+         * @param origin Center of the search.
+         * @param min_z,max_z Range of z-levels to search.
+         * @param min_dist,max_dist Range of horizontal distance from origin to accept.
+         * @param result Findable locations are appended here, in no particular order.
+         * see omt_find_params for definitions of the other terms
+         */
+        void find_in_overmap( const overmap &om, const tripoint_abs_omt &origin, int min_z, int max_z,
+                              const omt_find_params &params, int min_dist, int max_dist,
+                              std::vector<tripoint_abs_omt> &result ) const;
 
         std::unordered_map< point_abs_om, std::unique_ptr< overmap > > overmaps;
         /**
@@ -8,6 +8,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -518,9 +519,13 @@ std::vector<stacked_items> stack_for_pickup_ui( const
     std::vector<stacked_items> restacked_with_parents;
     for( const auto &pr : children_by_parent ) {
         std::vector<std::list<item_stack::iterator>> restacked_children;
+        // Only stacks whose items hash the same way can take an item
+        std::unordered_map<size_t, std::vector<size_t>> buckets;
         for( item_stack::iterator it : pr.second.unstacked_children ) {
+            std::vector<size_t> &bucket = buckets[it->stacking_hash()];
             bool found_stack = false;
-            for( std::list<item_stack::iterator> &stack : restacked_children ) {
+            for( const size_t idx : bucket ) {
+                std::list<item_stack::iterator> &stack = restacked_children[idx];
                 const item &stack_top = *stack.front();
                 if( stack_top.display_stacked_with( *it ) ) {
                     stack.push_back( it );
@@ -529,6 +534,7 @@ std::vector<stacked_items> stack_for_pickup_ui( const
                 }
             }
             if( !found_stack ) {
+                bucket.push_back( restacked_children.size() );
                 restacked_children.emplace_back( std::list<item_stack::iterator>( { it } ) );
             }
         }
@@ -705,6 +711,25 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
         catacurses::window w_pickup;
         catacurses::window w_item_info;
 
+        // Nothing on the tile changes while the menu is open, so each stack's names and the
+        // selected item's info are generated once instead of on every redraw.
+        std::vector<cata::optional<std::string>> single_names( stacked_here.size() );
+        std::vector<cata::optional<std::string>> stack_names( stacked_here.size() );
+        const auto single_name = [&]( const size_t idx ) -> const std::string & {
+            if( !single_names[idx] ) {
+                single_names[idx] = stacked_here[idx].front()->display_name();
+            }
+            return *single_names[idx];
+        };
+        const auto stack_name = [&]( const size_t idx ) -> const std::string & {
+            if( !stack_names[idx] ) {
+                stack_names[idx] = stacked_here[idx].front()->display_name( stacked_here[idx].size() );
+            }
+            return *stack_names[idx];
+        };
+        int info_item = -1;
+        std::vector<iteminfo> info_cache;
+
         ui_adaptor ui;
         ui.on_screen_resize( [&]( ui_adaptor & ui ) {
             const int itemsH = std::min( 25, TERMY / 2 );
@@ -722,9 +747,8 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
             pickupH = maxitems + pickupBorderRows;
 
             //find max length of item name and resize pickup window width
-            for( const std::list<item_stack::iterator> &cur_list : stacked_here ) {
-                const item &this_item = *cur_list.front();
-                const int item_len = utf8_width( remove_color_tags( this_item.display_name() ) ) + 10;
+            for( size_t i = 0; i < stacked_here.size(); i++ ) {
+                const int item_len = utf8_width( remove_color_tags( single_name( i ) ) ) + 10;
                 if( item_len > pickupW && item_len < TERMX ) {
                     pickupW = item_len;
                 }
@@ -791,10 +815,13 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
             const item &selected_item = *stacked_here[matches[selected]].front();
 
             if( selected >= 0 && selected <= static_cast<int>( stacked_here.size() ) - 1 ) {
-                std::vector<iteminfo> vThisItem;
-                selected_item.info( true, vThisItem );
+                if( info_item != matches[selected] ) {
+                    info_cache.clear();
+                    selected_item.info( true, info_cache );
+                    info_item = matches[selected];
+                }
 
-                item_info_data dummy( {}, {}, vThisItem, {}, iScrollPos );
+                item_info_data dummy( {}, {}, info_cache, {}, iScrollPos );
                 dummy.without_getch = true;
                 dummy.without_border = true;
 
@@ -808,7 +835,7 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
             // print info window title: < item name >
             mvwprintw( w_item_info, point( 2, 0 ), "< " );
             trim_and_print( w_item_info, point( 4, 0 ), pickupW - 8, selected_item.color_in_inventory(),
-                            selected_item.display_name() );
+                            single_name( matches[selected] ) );
             wprintw( w_item_info, " >" );
             wnoutrefresh( w_item_info );
 
@@ -881,7 +908,7 @@ void pickup::pick_up( const tripoint &p, int min, from_where get_items_from )
                             item_name = stacked_here[true_it].front()->display_money( item_count, charges_total, charges );
                         }
                     } else {
-                        item_name = this_item.display_name( stacked_here[true_it].size() );
+                        item_name = stack_name( true_it );
                     }
                     if( stacked_here[true_it].size() > 1 ) {
                         item_name = string_format( "%d %s", stacked_here[true_it].size(), item_name );
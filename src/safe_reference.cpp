@@ -1,16 +1,40 @@
 #include "safe_reference.h"
 
-safe_reference_anchor::safe_reference_anchor()
-{
-    impl = std::make_shared<empty>();
-}
-
 safe_reference_anchor::safe_reference_anchor( const safe_reference_anchor & ) :
     safe_reference_anchor()
 {}
 
 safe_reference_anchor &safe_reference_anchor::operator=( const safe_reference_anchor & )
 {
-    impl = std::make_shared<empty>();
+    release_slot();
     return *this;
 }
+
+safe_reference_anchor::~safe_reference_anchor()
+{
+    release_slot();
+}
+
+void safe_reference_anchor::acquire_slot()
+{
+    slot_table &t = table();
+    if( t.free_slots.empty() ) {
+        slot = static_cast<uint32_t>( t.generations.size() );
+        t.generations.push_back( 0 );
+    } else {
+        slot = t.free_slots.back();
+        t.free_slots.pop_back();
+    }
+}
+
+void safe_reference_anchor::release_slot()
+{
+    if( slot == 0 ) {
+        return;
+    }
+    slot_table &t = table();
+    // Invalidates every reference taken from this anchor
+    ++t.generations[slot];
+    t.free_slots.push_back( slot );
+    slot = 0;
+}
@@ -16,9 +16,62 @@ object from an invalidated safe_reference, it returns nullptr.
 The motivating use case is to store references to items in item_locations in a
 way that is safe if that item is moved or destroyed.
 
+An anchor takes a slot in a global table of generation counters the first time
+a reference is taken from it, and bumps the slot's generation when it goes
+away.  A reference is the object pointer plus the slot and generation it was
+taken with, so checking it is a single table lookup, and anchors that never
+hand out references (most items) cost nothing.
+
 */
 
-#include <memory>
+#include <cstdint>
+#include <vector>
+
+template<typename T>
+class safe_reference;
+
+class safe_reference_anchor
+{
+    public:
+        safe_reference_anchor() = default;
+        safe_reference_anchor( const safe_reference_anchor & );
+        safe_reference_anchor &operator=( const safe_reference_anchor & );
+        ~safe_reference_anchor();
+
+        template<typename T>
+        safe_reference<T> reference_to( T *object ) {
+            if( slot == 0 ) {
+                acquire_slot();
+            }
+            return safe_reference<T>( object, slot, table().generations[slot] );
+        }
+
+        /** Whether references taken with this slot and generation are still valid */
+        static bool is_current( uint32_t slot, uint32_t generation ) {
+            return table().generations[slot] == generation;
+        }
+    private:
+        /**
+         * Not synchronized, unlike the reference count of a shared_ptr. Anchors (and so items)
+         * must be created, copied and destroyed on the main thread only. The detached sound
+         * threads in sounds.cpp must not touch items.
+         */
+        struct slot_table {
+            /** Slot 0 is never handed out, it marks anchors without a slot */
+            std::vector<uint32_t> generations = { 0 };
+            std::vector<uint32_t> free_slots;
+        };
+        static slot_table &table() {
+            // Never destroyed, so that anchors in static objects can release their slots at exit
+            static slot_table *const instance = new slot_table();
+            return *instance;
+        }
+
+        void acquire_slot();
+        void release_slot();
+
+        uint32_t slot = 0;
+};
 
 template<typename T>
 class safe_reference
@@ -27,7 +80,7 @@ class safe_reference
         safe_reference() = default;
 
         T *get() const {
-            return impl.lock().get();
+            return object && safe_reference_anchor::is_current( slot, generation ) ? object : nullptr;
         }
 
         explicit operator bool() const {
@@ -35,7 +88,7 @@ class safe_reference
         }
 
         bool operator!() const {
-            return impl.expired();
+            return get() == nullptr;
         }
 
         T &operator*() const {
@@ -48,26 +101,12 @@ class safe_reference
     private:
         friend class safe_reference_anchor;
 
-        safe_reference( const std::shared_ptr<T> &p ) : impl( p ) {}
-
-        std::weak_ptr<T> impl;
-};
-
-class safe_reference_anchor
-{
-    public:
-        safe_reference_anchor();
-        safe_reference_anchor( const safe_reference_anchor & );
-        safe_reference_anchor &operator=( const safe_reference_anchor & );
+        safe_reference( T *object, uint32_t slot, uint32_t generation ) :
+            object( object ), slot( slot ), generation( generation ) {}
 
-        template<typename T>
-        safe_reference<T> reference_to( T *object ) {
-            // Using the shared_ptr aliasing constructor
-            return safe_reference<T>( std::shared_ptr<T>( impl, object ) );
-        }
-    private:
-        struct empty {};
-        std::shared_ptr<empty> impl;
+        T *object = nullptr;
+        uint32_t slot = 0;
+        uint32_t generation = 0;
 };
 
 #endif // CATA_SRC_SAFE_REFERENCE_H
@@ -463,6 +463,7 @@ void overmap::unserialize( std::istream &fin, const std::string &file_path )
                         layer[z].terrain[i][j] = tmp_otid;
                     }
                 }
+                ter_index[z].dirty = true;
                 jsin.end_array();
             }
             jsin.end_array();
@@ -2309,13 +2309,9 @@ void item::io( Archive &archive )
     // Books without any chapters don't need to store a remaining-chapters
     // counter, it will always be 0 and it prevents proper stacking.
     if( get_chapters() == 0 ) {
-        for( auto it = item_vars.begin(); it != item_vars.end(); ) {
-            if( it->first.compare( 0, 19, "remaining-chapters-" ) == 0 ) {
-                item_vars.erase( it++ );
-            } else {
-                ++it;
-            }
-        }
+        item_vars.erase_if( []( const std::string & name ) {
+            return name.compare( 0, 19, "remaining-chapters-" ) == 0;
+        } );
     }
 
     // Remove stored translated gerund in favor of storing the inscription tool type
@@ -3189,7 +3185,7 @@ void player_morale::load( const JsonObject &jsin )
 }
 
 struct mm_elem {
-    memorized_terrain_tile tile;
+    uint32_t tile;
     int symbol;
 
     bool operator==( const mm_elem &rhs ) const {
@@ -3197,7 +3193,8 @@ struct mm_elem {
     }
 };
 
-void mm_submap::serialize( JsonOut &jsout ) const
+void mm_submap::serialize( JsonOut &jsout,
+                           const std::unordered_map<uint32_t, int> &tile_indices ) const
 {
     jsout.start_array();
 
@@ -3207,10 +3204,11 @@ void mm_submap::serialize( JsonOut &jsout ) const
     int num_same = 1;
 
     const auto write_seq = [&]() {
+        const memorized_terrain_tile tile = unpack( last.tile );
         jsout.start_array();
-        jsout.write( last.tile.tile );
-        jsout.write( last.tile.subtile );
-        jsout.write( last.tile.rotation );
+        jsout.write( tile_indices.at( packed_id( last.tile ) ) );
+        jsout.write( tile.subtile );
+        jsout.write( tile.rotation );
         jsout.write( last.symbol );
         if( num_same != 1 ) {
             jsout.write( num_same );
@@ -3221,7 +3219,7 @@ void mm_submap::serialize( JsonOut &jsout ) const
     for( size_t y = 0; y < SEEY; y++ ) {
         for( size_t x = 0; x < SEEX; x++ ) {
             point p( x, y );
-            const mm_elem elem = { tile( p ), symbol( p ) };
+            const mm_elem elem = { packed_tile( p ), symbol( p ) };
             if( x == 0 && y == 0 ) {
                 last = elem;
                 continue;
@@ -3240,12 +3238,15 @@ void mm_submap::serialize( JsonOut &jsout ) const
     jsout.end_array();
 }
 
-void mm_submap::deserialize( JsonIn &jsin )
+/**
+ * Reads RLE-compressed tile runs of a submap.
+ * @param read_tile reads the tile part of a run.
+ */
+template<typename TileReader>
+static void deserialize_mm_runs( mm_submap &sm, JsonIn &jsin, const TileReader &read_tile )
 {
     jsin.start_array();
 
-    // Uses RLE for compression.
-
     mm_elem elem;
     size_t remaining = 0;
 
@@ -3255,9 +3256,7 @@ void mm_submap::deserialize( JsonIn &jsin )
                 remaining -= 1;
             } else {
                 jsin.start_array();
-                elem.tile.tile = jsin.get_string();
-                elem.tile.subtile = jsin.get_int();
-                elem.tile.rotation = jsin.get_int();
+                elem.tile = read_tile();
                 elem.symbol = jsin.get_int();
                 if( jsin.test_int() ) {
                     remaining = jsin.get_int() - 1;
@@ -3266,19 +3265,69 @@ void mm_submap::deserialize( JsonIn &jsin )
             }
             point p( x, y );
             // Try to avoid assigning to save up on memory
-            if( elem.tile != mm_submap::default_tile ) {
-                set_tile( p, elem.tile );
+            if( elem.tile != 0 ) {
+                sm.set_packed_tile( p, elem.tile );
             }
             if( elem.symbol != mm_submap::default_symbol ) {
-                set_symbol( p, elem.symbol );
+                sm.set_symbol( p, elem.symbol );
             }
         }
     }
     jsin.end_array();
 }
 
+void mm_submap::deserialize( JsonIn &jsin, const std::vector<uint32_t> &tile_ids )
+{
+    deserialize_mm_runs( *this, jsin, [&]() {
+        const int idx = jsin.get_int();
+        const uint32_t id = idx >= 0 && static_cast<size_t>( idx ) < tile_ids.size() ? tile_ids[idx] : 0;
+        const int subtile = jsin.get_int();
+        const int rotation = jsin.get_int();
+        return pack_id( id, subtile, rotation );
+    } );
+}
+
+void mm_submap::deserialize_legacy( JsonIn &jsin )
+{
+    deserialize_mm_runs( *this, jsin, [&]() {
+        memorized_terrain_tile tile;
+        tile.tile = jsin.get_string();
+        tile.subtile = jsin.get_int();
+        tile.rotation = jsin.get_int();
+        return pack( tile );
+    } );
+}
+
 void mm_region::serialize( JsonOut &jsout ) const
 {
+    // Each distinct tile name is written once, in order of first appearance.
+    std::unordered_map<uint32_t, int> tile_indices;
+    std::vector<uint32_t> tile_ids;
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            const shared_ptr_fast<mm_submap> &sm = submaps[x][y];
+            if( sm->is_empty() ) {
+                continue;
+            }
+            for( size_t sy = 0; sy < SEEY; sy++ ) {
+                for( size_t sx = 0; sx < SEEX; sx++ ) {
+                    const uint32_t id = mm_submap::packed_id( sm->packed_tile( point( sx, sy ) ) );
+                    if( tile_indices.emplace( id, static_cast<int>( tile_ids.size() ) ).second ) {
+                        tile_ids.push_back( id );
+                    }
+                }
+            }
+        }
+    }
+
+    jsout.start_object();
+    jsout.member( "tiles" );
+    jsout.start_array();
+    for( const uint32_t id : tile_ids ) {
+        jsout.write( mm_submap::tile_name( id ) );
+    }
+    jsout.end_array();
+    jsout.member( "submaps" );
     jsout.start_array();
     // NOLINTNEXTLINE(modernize-loop-convert): leaving as is for readability
     for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
@@ -3288,30 +3337,59 @@ void mm_region::serialize( JsonOut &jsout ) const
             if( sm->is_empty() ) {
                 jsout.write_null();
             } else {
-                sm->serialize( jsout );
+                sm->serialize( jsout, tile_indices );
             }
         }
     }
     jsout.end_array();
+    jsout.end_object();
 }
 
 void mm_region::deserialize( JsonIn &jsin )
 {
-    jsin.start_array();
-    // NOLINTNEXTLINE(modernize-loop-convert): leaving as is for readability
-    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+    const auto read_submaps = [&]( const auto &read ) {
+        jsin.start_array();
         // NOLINTNEXTLINE(modernize-loop-convert): leaving as is for readability
-        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
-            shared_ptr_fast<mm_submap> &sm = submaps[x][y];
-            sm = make_shared_fast<mm_submap>();
-            if( jsin.test_null() ) {
-                jsin.skip_null();
-            } else {
-                sm->deserialize( jsin );
+        for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+            // NOLINTNEXTLINE(modernize-loop-convert): leaving as is for readability
+            for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+                shared_ptr_fast<mm_submap> &sm = submaps[x][y];
+                sm = make_shared_fast<mm_submap>();
+                if( jsin.test_null() ) {
+                    jsin.skip_null();
+                } else {
+                    read( *sm );
+                }
             }
         }
+        jsin.end_array();
+    };
+
+    if( jsin.test_array() ) {
+        // Old format, with tile names written for every run
+        read_submaps( [&]( mm_submap & sm ) {
+            sm.deserialize_legacy( jsin );
+        } );
+        return;
+    }
+
+    std::vector<uint32_t> tile_ids;
+    jsin.start_object();
+    while( !jsin.end_object() ) {
+        const std::string name = jsin.get_member_name();
+        if( name == "tiles" ) {
+            jsin.start_array();
+            while( !jsin.end_array() ) {
+                tile_ids.push_back( mm_submap::tile_id( jsin.get_string() ) );
+            }
+        } else if( name == "submaps" ) {
+            read_submaps( [&]( mm_submap & sm ) {
+                sm.deserialize( jsin, tile_ids );
+            } );
+        } else {
+            jsin.skip_value();
+        }
     }
-    jsin.end_array();
 }
 
 void map_memory::load_legacy( JsonIn &jsin )
@@ -3028,20 +3028,29 @@ void vehicle::precalc_mounts( int idir, units::angle dir, const point &pivot )
     if( idir < 0 || idir > 1 ) {
         idir = 0;
     }
-    tileray tdir( dir );
-    std::unordered_map<point, point> mount_to_precalc;
-    for( auto &p : parts ) {
-        if( p.removed ) {
-            continue;
+    // Vehicles mostly keep their facing between moves, so reuse the footprint
+    // from the last time this facing was seen.
+    std::vector<point> &footprint = precalc_footprints[std::make_pair( dir, pivot )];
+    if( footprint.size() != parts.size() ) {
+        footprint.clear();
+        footprint.reserve( parts.size() );
+        tileray tdir( dir );
+        std::unordered_map<point, point> mount_to_precalc;
+        for( const vehicle_part &p : parts ) {
+            auto q = mount_to_precalc.find( p.mount );
+            if( q == mount_to_precalc.end() ) {
+                tripoint res;
+                coord_translate( tdir, pivot, p.mount, res );
+                q = mount_to_precalc.emplace( p.mount, res.xy() ).first;
+            }
+            footprint.push_back( q->second );
         }
-        auto q = mount_to_precalc.find( p.mount );
-        if( q == mount_to_precalc.end() ) {
-            coord_translate( tdir, pivot, p.mount, p.precalc[idir] );
-            p.precalc[idir].z = 0;
-            mount_to_precalc.insert( { p.mount, p.precalc[idir].xy() } );
-        } else {
-            p.precalc[idir] = {q->second, 0};
+    }
+    for( size_t i = 0; i < parts.size(); i++ ) {
+        if( parts[i].removed ) {
+            continue;
         }
+        parts[i].precalc[idir] = tripoint( footprint[i], 0 );
     }
     pivot_anchor[idir] = pivot;
     pivot_rotation[idir] = dir;
@@ -3273,6 +3282,7 @@ int vehicle::drain( const itype_id &ftype, int amount )
     }
 
     invalidate_mass();
+    get_map().bump_charges_revision();
     return drained;
 }
 
@@ -3294,6 +3304,7 @@ int vehicle::drain( const int index, int amount )
 
     const int drained = pt.ammo_consume( amount, global_part_pos3( pt ) );
     invalidate_mass();
+    get_map().bump_charges_revision();
     return drained;
 }
 
@@ -4928,6 +4939,7 @@ void traverse( StartPoint &start,
 
 int vehicle::charge_battery( int amount, bool include_other_vehicles )
 {
+    get_map().bump_charges_revision();
     // Key parts by percentage charge level.
     std::multimap<int, vehicle_part *> chargeable_parts;
     for( vehicle_part &p : parts ) {
@@ -4975,6 +4987,7 @@ int vehicle::charge_battery( int amount, bool include_other_vehicles )
 
 int vehicle::discharge_battery( int amount, bool recurse )
 {
+    get_map().bump_charges_revision();
     // Key parts by percentage charge level.
     std::multimap<int, vehicle_part *> dischargeable_parts;
     for( vehicle_part &p : parts ) {
@@ -5237,6 +5250,7 @@ cata::optional<vehicle_stack::iterator> vehicle::add_item( int part, const item
         item *here = istack.stacks_with( itm );
         if( here ) {
             invalidate_mass();
+            get_map().bump_contents_revision();
             if( !here->merge_charges( itm ) ) {
                 return cata::nullopt;
             } else {
@@ -5257,6 +5271,7 @@ cata::optional<vehicle_stack::iterator> vehicle::add_item( int part, const item
     }
 
     invalidate_mass();
+    get_map().bump_contents_revision();
     return cata::optional<vehicle_stack::iterator>( new_pos );
 }
 
@@ -5279,6 +5294,7 @@ vehicle_stack::iterator vehicle::remove_item( int part, vehicle_stack::const_ite
     active_items.remove( &*it );
 
     invalidate_mass();
+    get_map().bump_contents_revision();
     return veh_items.erase( it );
 }
 
@@ -5496,6 +5512,8 @@ void vehicle::refresh()
     wheelcache.clear();
     rail_wheelcache.clear();
     rotors.clear();
+    collision_parts.clear();
+    precalc_footprints.clear();
     steering.clear();
     speciality.clear();
     floating.clear();
@@ -5543,6 +5561,9 @@ void vehicle::refresh()
         if( vpi.has_flag( VPFLAG_FLOATS ) ) {
             floating.push_back( p );
         }
+        if( vpi.location == part_location_structure || vpi.rotor_diameter() > 0 ) {
+            collision_parts.push_back( p );
+        }
 
         if( vp.part().is_unavailable() ) {
             continue;
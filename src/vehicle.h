@@ -1460,6 +1460,9 @@ class vehicle
 
         // Handle given part collision with vehicle, monster/NPC/player or terrain obstacle
         // Returns collision, which has type, impulse, part, & target.
+        // Cheap check whether part_collision could find anything at p, to skip
+        // the full check for parts moving onto plain empty ground.
+        bool may_collide_at( const tripoint &p, bool bash_floor ) const;
         veh_collision part_collision( int part, const tripoint &p,
                                       bool just_detect, bool bash_floor );
 
@@ -1797,6 +1800,7 @@ class vehicle
         std::vector<int> loose_parts;      // List of UNMOUNT_ON_MOVE parts
         std::vector<int> wheelcache;       // List of wheels
         std::vector<int> rotors;           // List of rotors
+        std::vector<int> collision_parts;  // List of structure and rotor parts
         std::vector<int> rail_wheelcache;  // List of rail wheels
         std::vector<int> steering;         // List of STEERABLE parts
         // List of parts that will not be on a vehicle very often, or which only one will be present
@@ -1924,6 +1928,8 @@ class vehicle
         towing_data tow_data;
         // points used for rotation of mount precalc values
         std::array<point, 2> pivot_anchor;
+        // precalc offsets of every part, per facing and pivot seen since the last refresh
+        std::map<std::pair<units::angle, point>, std::vector<point>> precalc_footprints;
         // frame direction
         tileray face;
         // direction we are moving
@@ -396,16 +396,20 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
     int lowest_velocity = coll_velocity;
     const int sign_before = sgn( velocity_before );
     bool empty = true;
-    for( int p = 0; static_cast<size_t>( p ) < parts.size(); p++ ) {
-        const vpart_info &info = part_info( p );
-        if( ( info.location != part_location_structure && info.rotor_diameter() == 0 ) ||
-            parts[ p ].removed ) {
+    const tripoint pos = global_pos3();
+    // Copy, as collisions can remove parts and refresh the vehicle
+    const std::vector<int> candidates = collision_parts;
+    for( const int p : candidates ) {
+        if( static_cast<size_t>( p ) >= parts.size() || parts[ p ].removed ) {
             continue;
         }
         empty = false;
         // Coordinates of where part will go due to movement (dx/dy/dz)
         //  and turning (precalc[1])
-        const tripoint dsp = global_pos3() + dp + parts[p].precalc[1];
+        const tripoint dsp = pos + dp + parts[p].precalc[1];
+        if( !may_collide_at( dsp, bash_floor ) ) {
+            continue;
+        }
         veh_collision coll = part_collision( p, dsp, just_detect, bash_floor );
         if( coll.type == veh_coll_nothing ) {
             continue;
@@ -455,6 +459,23 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
     return !colls.empty();
 }
 
+bool vehicle::may_collide_at( const tripoint &p, bool bash_floor ) const
+{
+    if( bash_floor ) {
+        return true;
+    }
+    map &here = get_map();
+    if( !here.inbounds( p ) || g->critter_at( p, true ) != nullptr ) {
+        return true;
+    }
+    const optional_vpart_position ovp = here.veh_at( p );
+    if( ovp && &ovp->vehicle() != this ) {
+        return true;
+    }
+    // Flat terrain and furniture is neither bashed nor impassable, see part_collision
+    return here.move_cost_ter_furn( p ) != 2;
+}
+
 // A helper to make sure mass and density is always calculated the same way
 static void terrain_collision_data( const tripoint &p, bool bash_floor,
                                     float &mass, float &density, float &elastic )
@@ -474,13 +495,9 @@ veh_collision vehicle::part_collision( int part, const tripoint &p,
     // Vertical collisions need to be handled differently
     // All collisions have to be either fully vertical or fully horizontal for now
     const bool vert_coll = bash_floor || p.z != sm_pos.z;
-    Character &player_character = get_player_character();
-    const bool pl_ctrl = player_in_control( player_character );
     Creature *critter = g->critter_at( p, true );
     player *ph = dynamic_cast<player *>( critter );
 
-    Creature *driver = pl_ctrl ? &player_character : nullptr;
-
     // If in a vehicle assume it's this one
     if( ph != nullptr && ph->in_vehicle ) {
         critter = nullptr;
@@ -600,6 +617,9 @@ veh_collision vehicle::part_collision( int part, const tripoint &p,
         return ret;
     }
     stop_autodriving();
+    Character &player_character = get_player_character();
+    const bool pl_ctrl = player_in_control( player_character );
+    Creature *driver = pl_ctrl ? &player_character : nullptr;
     // Calculate mass AFTER checking for collision
     //  because it involves iterating over all cargo
     // Rotors only use rotor mass in calculation.
@@ -651,6 +651,7 @@ std::list<item> visitable<inventory>::remove_items_with( const
     }
 
     // Invalidate binning cache
+    inv->bump_revision();
     inv->binned = false;
     inv->items_type_cached = false;
 
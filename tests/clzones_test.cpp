@@ -0,0 +1,88 @@
+#include "catch/catch.hpp"
+
+#include <sstream>
+#include <unordered_set>
+#include <vector>
+
+#include "clzones.h"
+#include "item.h"
+#include "json.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "memory_fast.h"
+#include "point.h"
+#include "type_id.h"
+
+static shared_ptr_fast<zone_options> custom_loot( const std::string &filter )
+{
+    shared_ptr_fast<loot_options> options = make_shared_fast<loot_options>();
+    std::istringstream is( R"({"mark":")" + filter + R"("})" );
+    JsonIn jsin( is );
+    options->deserialize( jsin.get_object() );
+    return options;
+}
+
+TEST_CASE( "loot_zones_near_an_item", "[zones]" )
+{
+    clear_map();
+    zone_manager::reset_manager();
+    zone_manager &mgr = zone_manager::get_manager();
+    const zone_type_id loot_custom( "LOOT_CUSTOM" );
+    const zone_type_id loot_food( "LOOT_FOOD" );
+    const tripoint where = get_map().getabs( tripoint( 60, 60, 0 ) );
+
+    mgr.add( "Rocks", loot_custom, your_fac, false, true, where + tripoint_east,
+             where + tripoint_east, custom_loot( "rock" ) );
+    mgr.add( "Food", loot_food, your_fac, false, true, where + tripoint_west,
+             where + tripoint_west );
+
+    const item rock( "rock" );
+    const item apple( "apple" );
+    CHECK( mgr.get_near_zone_type_for_item( rock, where ) == loot_custom );
+    CHECK( mgr.get_near_zone_type_for_item( apple, where ) == loot_food );
+    CHECK( mgr.get_near( loot_custom, where, 10, &rock ).size() == 1 );
+    CHECK( mgr.get_near( loot_custom, where, 10, &apple ).empty() );
+    CHECK( mgr.get_near( loot_food, where, 10, &apple ).size() == 1 );
+
+    zone_manager::reset_manager();
+}
+
+TEST_CASE( "loot_destinations_agree_with_zone_manager", "[zones]" )
+{
+    clear_map();
+    zone_manager::reset_manager();
+    zone_manager &mgr = zone_manager::get_manager();
+    const zone_type_id loot_custom( "LOOT_CUSTOM" );
+    const tripoint where = get_map().getabs( tripoint( 60, 60, 0 ) );
+    const int range = 10;
+
+    mgr.add( "Rocks", loot_custom, your_fac, false, true, where + point( 1, -1 ),
+             where + point( 2, 1 ), custom_loot( "rock" ) );
+    mgr.add( "Apples", loot_custom, your_fac, false, true, where + point( -4, 3 ),
+             where + point( -3, 3 ), custom_loot( "apple" ) );
+    // Partly under the rock zone, so some of its tiles only take rocks
+    mgr.add( "Food", zone_type_id( "LOOT_FOOD" ), your_fac, false, true, where + point( 2, 0 ),
+             where + point( 4, 2 ) );
+    mgr.add( "Wood", zone_type_id( "LOOT_WOOD" ), your_fac, false, true, where + point( -2, -5 ),
+             where + point( 0, -4 ) );
+    mgr.add( "Far food", zone_type_id( "LOOT_FOOD" ), your_fac, false, true,
+             where + point( range + 1, 0 ), where + point( range + 2, 0 ) );
+    mgr.cache_data();
+
+    const loot_destinations &destinations = mgr.get_loot_destinations( where, range );
+    for( const char *id : {
+             "rock", "apple", "2x4", "scrap"
+         } ) {
+        const item it( id );
+        INFO( id );
+        CHECK( destinations.zone_type_for( it ) == mgr.get_near_zone_type_for_item( it, where, range ) );
+        for( const auto &type : mgr.get_types() ) {
+            INFO( type.first.str() );
+            const std::vector<tripoint> tiles = destinations.tiles_for( type.first, it );
+            CHECK( std::unordered_set<tripoint>( tiles.begin(), tiles.end() ) ==
+                   mgr.get_near( type.first, where, range, &it ) );
+        }
+    }
+
+    zone_manager::reset_manager();
+}
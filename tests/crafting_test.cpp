@@ -18,6 +18,7 @@
 #include "crafting.h"
 #include "distribution_grid.h"
 #include "game.h"
+#include "inventory.h"
 #include "item.h"
 #include "itype.h"
 #include "map.h"
@@ -613,6 +614,84 @@ TEST_CASE( "debug hammerspace", "[crafting]" )
     }
 }
 
+TEST_CASE( "crafting inventory reflects map changes within a turn", "[crafting][inventory]" )
+{
+    clear_map();
+    clear_avatar();
+    avatar &u = get_avatar();
+    map &here = get_map();
+    const tripoint test_origin( 60, 60, 0 );
+    const tripoint nearby = test_origin + tripoint_east;
+    const itype_id hammer( "hammer" );
+    u.setpos( test_origin );
+    REQUIRE( !u.crafting_inventory().has_amount( hammer, 1 ) );
+
+    WHEN( "an item is placed nearby without spending moves" ) {
+        item &placed = here.add_item( nearby, item( hammer ) );
+        THEN( "it is found in the crafting inventory" ) {
+            CHECK( u.crafting_inventory().has_amount( hammer, 1 ) );
+        }
+        THEN( "it is not found when the search radius excludes it" ) {
+            CHECK( !u.crafting_inventory( test_origin, 0, false ).has_amount( hammer, 1 ) );
+            CHECK( u.crafting_inventory( test_origin, 1, false ).has_amount( hammer, 1 ) );
+        }
+        AND_WHEN( "it is removed again" ) {
+            REQUIRE( u.crafting_inventory().has_amount( hammer, 1 ) );
+            here.i_rem( nearby, &placed );
+            THEN( "it is no longer in the crafting inventory" ) {
+                CHECK( !u.crafting_inventory().has_amount( hammer, 1 ) );
+            }
+        }
+    }
+}
+
+TEST_CASE( "crafting inventory keeps map items while own items change", "[crafting][inventory]" )
+{
+    clear_map();
+    clear_avatar();
+    avatar &u = get_avatar();
+    const tripoint test_origin( 60, 60, 0 );
+    const itype_id hammer( "hammer" );
+    const itype_id pockknife( "pockknife" );
+    const quality_id qual_CUT( "CUT" );
+    const quality_id qual_HAMMER( "HAMMER" );
+    u.setpos( test_origin );
+    get_map().add_item( test_origin + tripoint_east, item( hammer ) );
+    REQUIRE( u.crafting_inventory().has_amount( hammer, 1 ) );
+    REQUIRE( u.crafting_inventory().get_quality_cache().count( qual_CUT ) == 0 );
+
+    const auto check_qualities_match_items = [&]() {
+        const inventory &crafting_inv = u.crafting_inventory();
+        inventory fresh;
+        fresh += crafting_inv;
+        fresh.update_quality_cache();
+        CHECK( crafting_inv.get_quality_cache() == fresh.get_quality_cache() );
+    };
+
+    WHEN( "the character picks up a knife and spends moves" ) {
+        item &knife = u.i_add( item( pockknife ) );
+        u.moves -= 10;
+        THEN( "both the map and the character's items are found" ) {
+            CHECK( u.crafting_inventory().has_amount( hammer, 1 ) );
+            CHECK( u.crafting_inventory().has_amount( pockknife, 1 ) );
+            CHECK( u.crafting_inventory().get_quality_cache().count( qual_CUT ) == 1 );
+            CHECK( u.crafting_inventory().get_quality_cache().count( qual_HAMMER ) == 1 );
+            check_qualities_match_items();
+        }
+        AND_WHEN( "the knife is dropped from the inventory and more moves are spent" ) {
+            REQUIRE( u.crafting_inventory().has_amount( pockknife, 1 ) );
+            u.i_rem( &knife );
+            u.moves -= 10;
+            THEN( "only the map's items are left" ) {
+                CHECK( u.crafting_inventory().has_amount( hammer, 1 ) );
+                CHECK( !u.crafting_inventory().has_amount( pockknife, 1 ) );
+                CHECK( u.crafting_inventory().get_quality_cache().count( qual_CUT ) == 0 );
+                check_qualities_match_items();
+            }
+        }
+    }
+}
+
 TEST_CASE( "oven electric grid", "[crafting][overmap][grids][slow]" )
 {
     map &m = get_map();
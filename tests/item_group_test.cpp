@@ -1,13 +1,16 @@
 #include <algorithm>
+#include <map>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "catch/catch.hpp"
 
+#include "calendar.h"
 #include "item.h"
 #include "item_group.h"
 #include "stringmaker.h"
+#include "type_id.h"
 
 TEST_CASE( "spawn with default charges and with ammo", "[item_group]" )
 {
@@ -176,3 +179,39 @@ TEST_CASE( "item_modifier modifies charges for item", "[item_group]" )
         }
     }
 }
+
+static std::map<itype_id, int> count_draws( const Item_spawn_data &group, int draws )
+{
+    std::map<itype_id, int> counts;
+    for( int i = 0; i < draws; i++ ) {
+        counts[group.create_single( calendar::turn_zero ).typeId()]++;
+    }
+    return counts;
+}
+
+TEST_CASE( "distribution spawns entries in proportion to their weights", "[item_group]" )
+{
+    const int draws = 10000;
+    Item_group group( Item_group::G_DISTRIBUTION, 100, 0, 0 );
+    group.add_item_entry( itype_id( "rock" ), 10 );
+    group.add_item_entry( itype_id( "apple" ), 30 );
+    group.add_item_entry( itype_id( "scrap" ), 60 );
+    group.add_group_entry( item_group_id( "EMPTY_GROUP" ), 100 );
+
+    std::map<itype_id, int> counts = count_draws( group, draws );
+    CHECK( counts[itype_id( "rock" )] == Approx( draws * 0.05 ).margin( draws * 0.015 ) );
+    CHECK( counts[itype_id( "apple" )] == Approx( draws * 0.15 ).margin( draws * 0.02 ) );
+    CHECK( counts[itype_id( "scrap" )] == Approx( draws * 0.3 ).margin( draws * 0.025 ) );
+    // The empty group never spawns anything
+    CHECK( counts[itype_id::NULL_ID()] == Approx( draws * 0.5 ).margin( draws * 0.025 ) );
+
+    WHEN( "an entry is removed" ) {
+        group.remove_item( itype_id( "apple" ) );
+        counts = count_draws( group, draws );
+        THEN( "the rest keep their relative weights" ) {
+            CHECK( counts[itype_id( "apple" )] == 0 );
+            CHECK( counts[itype_id( "rock" )] == Approx( draws / 17.0 ).margin( draws * 0.015 ) );
+            CHECK( counts[itype_id( "scrap" )] == Approx( draws * 6 / 17.0 ).margin( draws * 0.025 ) );
+        }
+    }
+}
@@ -1,12 +1,18 @@
 #include "catch/catch.hpp"
 
+#include <algorithm>
 #include <initializer_list>
 #include <limits>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "calendar.h"
 #include "enums.h"
+#include "flag.h"
 #include "item.h"
+#include "item_factory.h"
 #include "itype.h"
 #include "ret_val.h"
 #include "math_defines.h"
@@ -159,3 +165,131 @@ TEST_CASE( "stacking_over_time", "[item]" )
         }
     }
 }
+
+TEST_CASE( "itype_flag_bits_match_item_tags", "[item][flag]" )
+{
+    for( const itype *type : item_controller->all() ) {
+        INFO( type->get_id().str() );
+        REQUIRE_FALSE( type->flag_bits.empty() );
+        std::vector<std::string> from_bits;
+        std::vector<std::string> from_tags;
+        for( const json_flag &f : json_flag::get_all() ) {
+            if( type->has_flag( f.id ) ) {
+                from_bits.push_back( f.id.str() );
+            }
+            if( type->item_tags.count( f.id.str() ) ) {
+                from_tags.push_back( f.id.str() );
+            }
+        }
+        CHECK( from_bits == from_tags );
+    }
+}
+
+TEST_CASE( "item_flags_come_from_type_mods_and_item", "[item][flag]" )
+{
+    item gun( "win70" );
+    REQUIRE_FALSE( gun.has_flag( "NOT_A_REAL_FLAG" ) );
+
+    // from the item type's JSON
+    CHECK( gun.has_flag( flag_str_id( "RELOAD_ONE" ) ) );
+
+    // from an installed gunmod
+    REQUIRE_FALSE( gun.has_flag( flag_str_id( "BELTED" ) ) );
+    item mod( "shoulder_strap" );
+    REQUIRE( gun.is_gunmod_compatible( mod ).success() );
+    gun.put_in( mod );
+    CHECK( gun.has_flag( flag_str_id( "BELTED" ) ) );
+
+    // set on the item itself
+    REQUIRE_FALSE( gun.has_flag( "IRREMOVABLE" ) );
+    gun.set_flag( "IRREMOVABLE" );
+    CHECK( gun.has_flag( "IRREMOVABLE" ) );
+    CHECK( gun.has_flag( flag_str_id( "IRREMOVABLE" ) ) );
+}
+
+static std::vector<item> stacking_variety()
+{
+    std::vector<item> items;
+    for( const char *id : {
+             "neccowafers", "rock", "glock_19", "cash_card", "water_clean", "9mm"
+         } ) {
+        const item plain( id );
+        items.push_back( plain );
+        items.push_back( item( plain ).set_damage( 1000 ) );
+        items.push_back( item( plain ).set_flag( "FIT" ) );
+        items.push_back( plain );
+        items.back().set_favorite( true );
+        items.push_back( plain );
+        items.back().set_var( "note", "written" );
+        items.push_back( plain );
+        items.back().mod_rot( 5_hours );
+        items.push_back( plain );
+    }
+    items.emplace_back( "cash_card", calendar::turn_zero, 0 );
+    items.emplace_back( "cash_card", calendar::turn_zero, 5 );
+    items.back().set_favorite( true );
+    return items;
+}
+
+TEST_CASE( "items_that_stack_hash_the_same", "[item]" )
+{
+    const std::vector<item> items = stacking_variety();
+    for( const item &a : items ) {
+        for( const item &b : items ) {
+            if( a.stacks_with( b ) ) {
+                INFO( a.tname() << " and " << b.tname() );
+                CHECK( a.stacking_hash() == b.stacking_hash() );
+            }
+        }
+    }
+    CHECK( item( "glock_19" ).stacking_hash() != item( "glock_19" ).set_damage( 1000 ).stacking_hash() );
+}
+
+// Groups the way the inventory menus did before they bucketed by stacking hash
+static size_t count_stacks_pairwise( const std::vector<item> &pile )
+{
+    std::vector<const item *> stack_tops;
+    for( const item &it : pile ) {
+        if( std::none_of( stack_tops.begin(), stack_tops.end(), [&it]( const item * top ) {
+        return top->display_stacked_with( it );
+        } ) ) {
+            stack_tops.push_back( &it );
+        }
+    }
+    return stack_tops.size();
+}
+
+static size_t count_stacks_bucketed( const std::vector<item> &pile )
+{
+    std::unordered_map<size_t, std::vector<const item *>> buckets;
+    size_t count = 0;
+    for( const item &it : pile ) {
+        std::vector<const item *> &tops = buckets[it.stacking_hash()];
+        if( std::none_of( tops.begin(), tops.end(), [&it]( const item * top ) {
+        return top->display_stacked_with( it );
+        } ) ) {
+            tops.push_back( &it );
+            ++count;
+        }
+    }
+    return count;
+}
+
+TEST_CASE( "stacking_large_pile_benchmark", "[.][item][benchmark]" )
+{
+    std::vector<item> pile;
+    for( int i = 0; i < 40; ++i ) {
+        for( const item &it : stacking_variety() ) {
+            pile.push_back( it );
+            pile.back().set_damage( i % 5 * 1000 );
+        }
+    }
+    REQUIRE( count_stacks_pairwise( pile ) == count_stacks_bucketed( pile ) );
+
+    BENCHMARK( "pairwise" ) {
+        return count_stacks_pairwise( pile );
+    };
+    BENCHMARK( "bucketed" ) {
+        return count_stacks_bucketed( pile );
+    };
+}
@@ -0,0 +1,73 @@
+#include "catch/catch.hpp"
+
+#include <map>
+#include <sstream>
+#include <string>
+
+#include "item_var_map.h"
+#include "json.h"
+#include "point.h"
+
+TEST_CASE( "item_var_map_round_trips_values", "[item][item_vars]" )
+{
+    item_var_map vars;
+    CHECK( vars.empty() );
+
+    vars.set( "int", 42LL );
+    vars.set( "real", 0.25 );
+    vars.set( "point", tripoint( 1, -2, 3 ) );
+    vars.set( "text", std::string( "hello" ) );
+
+    CHECK( vars.get( "int", 0.0 ) == 42 );
+    CHECK( vars.get( "int", std::string() ) == "42" );
+    CHECK( vars.get( "real", 0.0 ) == 0.25 );
+    CHECK( vars.get( "real", std::string() ) == "0.250000" );
+    CHECK( vars.get( "point", tripoint_zero ) == tripoint( 1, -2, 3 ) );
+    CHECK( vars.get( "point", std::string() ) == "1,-2,3" );
+    CHECK( vars.get( "text", std::string() ) == "hello" );
+    CHECK( vars.get( "missing", 7.0 ) == 7 );
+    CHECK( vars.get( "missing", std::string( "x" ) ) == "x" );
+
+    vars.erase( "int" );
+    CHECK_FALSE( vars.contains( "int" ) );
+    CHECK( vars.contains( "text" ) );
+}
+
+TEST_CASE( "item_var_map_compares_by_string_form", "[item][item_vars]" )
+{
+    item_var_map numeric;
+    item_var_map textual;
+    numeric.set( "a", 5LL );
+    numeric.set( "b", 1.5 );
+    numeric.set( "c", tripoint( 4, 5, 6 ) );
+    textual.set( "c", std::string( "4,5,6" ) );
+    textual.set( "b", std::string( "1.500000" ) );
+    textual.set( "a", std::string( "5" ) );
+    CHECK( numeric == textual );
+
+    // Not how the number is printed, so it has to stay a string
+    textual.set( "a", std::string( "05" ) );
+    CHECK( numeric != textual );
+    CHECK( textual.get( "a", std::string() ) == "05" );
+    CHECK( textual.get( "a", 0.0 ) == 5 );
+}
+
+TEST_CASE( "item_var_map_json_is_a_string_map", "[item][item_vars]" )
+{
+    item_var_map vars;
+    vars.set( "count", 3LL );
+    vars.set( "where", tripoint( 7, 8, 0 ) );
+    vars.set( "note", std::string( "written" ) );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    vars.serialize( jsout );
+    CHECK( os.str() == R"({"count":"3","note":"written","where":"7,8,0"})" );
+
+    std::istringstream is( os.str() );
+    JsonIn jsin( is );
+    item_var_map loaded;
+    loaded.deserialize( jsin );
+    CHECK( loaded == vars );
+    CHECK( loaded.to_map() == vars.to_map() );
+}
@@ -75,6 +75,104 @@ TEST_CASE( "map_memory_forgets", "[map_memory]" )
     memory.memorize_symbol( p3, 1 );
 }
 
+TEST_CASE( "map_memory_remembers_tiles", "[map_memory]" )
+{
+    map_memory memory;
+    memory.prepare_region( p1, p2 );
+    memory.memorize_tile( p1, "t_dirt", 2, 3 );
+    memory.memorize_tile( p2, "vp_frame", 7, 315 );
+    const memorized_terrain_tile t1 = memory.get_tile( p1 );
+    CHECK( t1.tile == "t_dirt" );
+    CHECK( t1.subtile == 2 );
+    CHECK( t1.rotation == 3 );
+    CHECK( memory.get_tile( p2 ) == memorized_terrain_tile{ "vp_frame", 7, 315 } );
+    memory.clear_memorized_tile( p2 );
+    CHECK( memory.get_tile( p2 ) == mm_submap::default_tile );
+}
+
+static mm_region make_test_region()
+{
+    mm_region reg;
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            reg.submaps[x][y] = make_shared_fast<mm_submap>();
+        }
+    }
+    mm_submap &sm = *reg.submaps[1][2];
+    sm.set_tile( point( 0, 0 ), memorized_terrain_tile{ "t_floor", 1, 2 } );
+    sm.set_tile( point( 1, 0 ), memorized_terrain_tile{ "t_floor", 1, 2 } );
+    sm.set_tile( point( 5, 3 ), memorized_terrain_tile{ "f_chair", 0, 1 } );
+    sm.set_tile( point( SEEX - 1, SEEY - 1 ), memorized_terrain_tile{ "vp_seat", 6, 90 } );
+    sm.set_symbol( point( 5, 3 ), '#' );
+    reg.submaps[0][0]->set_symbol( point( 2, 2 ), '.' );
+    return reg;
+}
+
+static void check_same_region( const mm_region &a, const mm_region &b )
+{
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            CHECK( a.submaps[x][y]->is_empty() == b.submaps[x][y]->is_empty() );
+            for( int sy = 0; sy < SEEY; sy++ ) {
+                for( int sx = 0; sx < SEEX; sx++ ) {
+                    const point p( sx, sy );
+                    CHECK( a.submaps[x][y]->tile( p ) == b.submaps[x][y]->tile( p ) );
+                    CHECK( a.submaps[x][y]->symbol( p ) == b.submaps[x][y]->symbol( p ) );
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE( "map_memory_region_save_load", "[map_memory]" )
+{
+    const mm_region reg = make_test_region();
+    std::ostringstream os;
+    JsonOut jsout( os );
+    reg.serialize( jsout );
+
+    // Each tile name is only written once per region
+    const std::string saved = os.str();
+    CHECK( saved.find( "t_floor" ) == saved.rfind( "t_floor" ) );
+
+    std::istringstream is( saved );
+    JsonIn jsin( is );
+    mm_region loaded;
+    loaded.deserialize( jsin );
+    check_same_region( reg, loaded );
+}
+
+TEST_CASE( "map_memory_region_loads_old_format", "[map_memory]" )
+{
+    // Old format: tile name, subtile, rotation, symbol and run length per run
+    std::string old_sm = string_format( R"([["t_floor",1,2,0,2],["",0,0,0,%d],["f_chair",0,1,35],)"
+                                        R"(["",0,0,0,%d],["vp_seat",6,90,0]])",
+                                        3 * SEEX + 5 - 2, SEEX * SEEY - ( 3 * SEEX + 5 ) - 2 );
+    std::string old_reg = "[";
+    for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+        for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+            if( x != 0 || y != 0 ) {
+                old_reg += ",";
+            }
+            if( x == 1 && y == 2 ) {
+                old_reg += old_sm;
+            } else if( x == 0 && y == 0 ) {
+                old_reg += string_format( R"([["",0,0,0,%d],["",0,0,46],["",0,0,0,%d]])",
+                                          2 * SEEX + 2, SEEX * SEEY - ( 2 * SEEX + 2 ) - 1 );
+            } else {
+                old_reg += "null";
+            }
+        }
+    }
+    old_reg += "]";
+
+    std::istringstream is( old_reg );
+    JsonIn jsin( is );
+    mm_region loaded;
+    loaded.deserialize( jsin );
+    check_same_region( make_test_region(), loaded );
+}
+
 // TODO: map memory save / load
 
 #include <chrono>
@@ -78,3 +78,28 @@ TEST_CASE( "monsters shouldn't see through floors", "[vision]" )
     CHECK( distant.sees( sky ) );
     fov_3d = old_fov_3d;
 }
+
+TEST_CASE( "line of sight cache is invalidated by terrain changes", "[vision]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint from( 5, 5, 0 );
+    const tripoint to( 10, 5, 0 );
+    const tripoint between( 7, 5, 0 );
+    here.build_map_cache( 0 );
+    here.reset_sight_cache_stats();
+
+    CHECK( here.sees( from, to, 60 ) );
+    CHECK( here.sees( to, from, 60 ) );
+    CHECK( here.get_sight_cache_stats().hits == 1 );
+    CHECK( here.get_sight_cache_stats().misses == 1 );
+
+    here.ter_set( between, t_wall );
+    here.build_map_cache( 0 );
+    CHECK( !here.sees( from, to, 60 ) );
+    CHECK( here.get_sight_cache_stats().misses == 2 );
+
+    here.ter_set( between, t_floor );
+    here.build_map_cache( 0 );
+    CHECK( here.sees( from, to, 60 ) );
+}
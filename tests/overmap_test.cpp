@@ -210,3 +210,84 @@ TEST_CASE( "is_ot_match", "[overmap][terrain]" )
         CHECK_FALSE( is_ot_match( "forestry", oter_id( "forest" ), ot_match_type::contains ) );
     }
 }
+
+TEST_CASE( "find_all_matching agrees with a full terrain scan", "[overmap][terrain]" )
+{
+    std::unique_ptr<overmap> test_overmap = std::make_unique<overmap>( point_abs_om() );
+    const oter_id lab( "central_lab" );
+    const tripoint_om_omt first( 10, 20, -2 );
+    const tripoint_om_omt second( 100, 5, -2 );
+
+    const auto brute_force = [&]( const std::string & otype, ot_match_type match_type, int z ) {
+        std::vector<tripoint_om_omt> found;
+        for( int x = 0; x < OMAPX; ++x ) {
+            for( int y = 0; y < OMAPY; ++y ) {
+                const tripoint_om_omt p( x, y, z );
+                if( is_ot_match( otype, test_overmap->ter( p ), match_type ) ) {
+                    found.push_back( p );
+                }
+            }
+        }
+        return found;
+    };
+    const auto indexed = [&]( const std::string & otype, ot_match_type match_type, int z ) {
+        std::vector<tripoint_om_omt> found = test_overmap->find_all_matching( otype, match_type, z );
+        std::sort( found.begin(), found.end() );
+        return found;
+    };
+
+    CHECK( indexed( "central_lab", ot_match_type::exact, -2 ).empty() );
+
+    test_overmap->ter_set( first, lab );
+    test_overmap->ter_set( second, lab );
+    CHECK( indexed( "central_lab", ot_match_type::exact, -2 ) ==
+           brute_force( "central_lab", ot_match_type::exact, -2 ) );
+    CHECK( indexed( "lab", ot_match_type::contains, -2 ).size() == 2 );
+    CHECK( indexed( "central_lab", ot_match_type::exact, -1 ).empty() );
+
+    // The index must notice terrain being replaced.
+    test_overmap->ter_set( first, oter_id( "empty_rock" ) );
+    CHECK( indexed( "central_lab", ot_match_type::exact, -2 ) ==
+           std::vector<tripoint_om_omt> { second } );
+    CHECK( indexed( "empty_rock", ot_match_type::exact, -2 ) ==
+           brute_force( "empty_rock", ot_match_type::exact, -2 ) );
+}
+
+TEST_CASE( "overmapbuffer finds terrain closest first across overmaps", "[overmap][terrain]" )
+{
+    // Overmaps without specials, far from the ones other tests generate, so no labs exist yet.
+    for( const point_abs_om &om_pos : {
+             point_abs_om( 20, 0 ), point_abs_om( 21, 0 )
+         } ) {
+        overmap_special_batch empty_specials( om_pos );
+        overmap_buffer.create_custom_overmap( om_pos, empty_specials );
+    }
+    const oter_id lab( "central_lab" );
+    const int z = -2;
+    const int edge = 21 * OMAPX;
+    const tripoint_abs_omt origin( edge - 5, 90, z );
+    // The nearer one is in the overmap that is searched second.
+    const tripoint_abs_omt near( edge + 1, 90, z );
+    const tripoint_abs_omt far( edge - 15, 90, z );
+    const tripoint_abs_omt beyond( edge - 20, 90, z );
+    overmap_buffer.ter_set( near, lab );
+    overmap_buffer.ter_set( far, lab );
+    overmap_buffer.ter_set( beyond, lab );
+
+    omt_find_params params;
+    params.types = { { "central_lab", ot_match_type::exact } };
+    params.existing_only = true;
+
+    params.search_range = 12;
+    CHECK( overmap_buffer.find_all( origin, params ) == std::vector<tripoint_abs_omt> { near, far } );
+    CHECK( overmap_buffer.find_closest( origin, params ) == near );
+
+    params.search_range = 5;
+    CHECK( overmap_buffer.find_all( origin, params ).empty() );
+    CHECK( overmap_buffer.find_closest( origin, params ) == overmap::invalid_tripoint );
+
+    params.search_range = 12;
+    params.min_distance = 7;
+    CHECK( overmap_buffer.find_all( origin, params ) == std::vector<tripoint_abs_omt> { far } );
+    CHECK( overmap_buffer.find_closest( origin, params ) == far );
+}
@@ -51,3 +51,16 @@ TEST_CASE( "safe_reference_not_shared_by_copy", "[safe_reference]" )
     CHECK( !ref0 );
     CHECK( ref1 );
 }
+
+TEST_CASE( "safe_reference_not_revived_by_reused_slot", "[safe_reference]" )
+{
+    std::unique_ptr<example> e0 = std::make_unique<example>();
+    safe_reference<example> ref0 = e0->get_ref();
+    e0.reset();
+    // Takes the slot just released by e0
+    example e1;
+    safe_reference<example> ref1 = e1.get_ref();
+    CHECK( !ref0 );
+    CHECK( ref1.get() == &e1 );
+    CHECK( safe_reference<example>().get() == nullptr );
+}
@@ -124,3 +124,19 @@ TEST_CASE( "Character is slowed down while overburdened", "[speed]" )
         carry_weight_test( guy, 102, 68 );
     }
 }
+
+TEST_CASE( "Carried weight follows inventory changes within a turn", "[speed]" )
+{
+    player &guy = prepare_player();
+    const units::mass base_weight = guy.weight_carried();
+    const units::volume base_volume = guy.volume_carried();
+
+    item item_1kg( "test_1kg_cube" );
+    guy.inv.add_item( item_1kg );
+    CHECK( guy.weight_carried() == base_weight + 1_kilogram );
+    CHECK( guy.volume_carried() == base_volume + 10_ml );
+
+    guy.inv.reduce_stack( guy.inv.position_by_type( item_1kg.typeId() ), 1 );
+    CHECK( guy.weight_carried() == base_weight );
+    CHECK( guy.volume_carried() == base_volume );
+}
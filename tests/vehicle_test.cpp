@@ -12,7 +12,10 @@
 #include "optional.h"
 #include "point.h"
 #include "type_id.h"
+#include "units_angle.h"
 #include "vehicle.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 
 TEST_CASE( "detaching_vehicle_unboards_passengers" )
 {
@@ -77,6 +80,96 @@ TEST_CASE( "add_item_to_broken_vehicle_part" )
     REQUIRE( !veh_ptr->add_item( *cargo_part, itm2 ) );
 }
 
+TEST_CASE( "vehicle_part_cache_tracks_every_tile" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vproto_id( "bicycle" ), vehicle_origin, 0_degrees, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+
+    const auto all_parts_cached = [&]() {
+        for( const vpart_reference &vp : veh_ptr->get_all_parts() ) {
+            const optional_vpart_position ovp = here.veh_at( vp.pos() );
+            if( !ovp || &ovp->vehicle() != veh_ptr ) {
+                return false;
+            }
+        }
+        return true;
+    };
+    REQUIRE( all_parts_cached() );
+    CHECK_FALSE( here.veh_at( vehicle_origin + tripoint( 5, 5, 0 ) ) );
+
+    // Clearing a point on behalf of another vehicle must not drop this one.
+    vehicle other;
+    here.clear_vehicle_point_from_cache( &other, vehicle_origin );
+    CHECK( here.veh_at( vehicle_origin ) );
+    here.clear_vehicle_point_from_cache( veh_ptr, vehicle_origin );
+    CHECK_FALSE( here.veh_at( vehicle_origin ) );
+
+    here.clear_vehicle_cache();
+    CHECK_FALSE( here.veh_at( vehicle_origin + tripoint_west ) );
+    here.add_vehicle_to_cache( veh_ptr );
+    CHECK( all_parts_cached() );
+}
+
+TEST_CASE( "reused_vehicle_footprints_match_fresh_ones" )
+{
+    clear_map();
+    map &here = get_map();
+    vehicle *turned = here.add_vehicle( vproto_id( "car" ), tripoint( 40, 40, 0 ), 0_degrees, 0, 0 );
+    vehicle *fresh = here.add_vehicle( vproto_id( "car" ), tripoint( 80, 80, 0 ), 0_degrees, 0, 0 );
+    REQUIRE( turned != nullptr );
+    REQUIRE( fresh != nullptr );
+    REQUIRE( turned->part_count() == fresh->part_count() );
+
+    const std::vector<units::angle> facings = {
+        15_degrees, 45_degrees, 90_degrees, 195_degrees, 270_degrees, 0_degrees
+    };
+    const point pivot = turned->pivot_point();
+    // Turning through every facing twice makes the second pass reuse the stored footprints
+    for( int pass = 0; pass < 2; pass++ ) {
+        for( const units::angle dir : facings ) {
+            turned->precalc_mounts( 1, dir, pivot );
+        }
+    }
+    for( const units::angle dir : facings ) {
+        CAPTURE( to_degrees( dir ) );
+        turned->precalc_mounts( 1, dir, pivot );
+        fresh->precalc_mounts( 1, dir, pivot );
+        for( int p = 0; p < turned->part_count(); p++ ) {
+            CHECK( turned->part( p ).precalc[1] == fresh->part( p ).precalc[1] );
+        }
+    }
+}
+
+TEST_CASE( "vehicle_broad_phase_only_skips_empty_flat_tiles" )
+{
+    clear_map_and_put_player_underground();
+    map &here = get_map();
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vproto_id( "bicycle" ), vehicle_origin, 0_degrees, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+
+    const tripoint open_ground = vehicle_origin + tripoint( 5, 0, 0 );
+    CHECK_FALSE( veh_ptr->may_collide_at( vehicle_origin, false ) );
+    CHECK_FALSE( veh_ptr->may_collide_at( open_ground, false ) );
+    CHECK( veh_ptr->may_collide_at( open_ground, true ) );
+    CHECK( veh_ptr->may_collide_at( tripoint( -1, -1, 0 ), false ) );
+
+    const tripoint wall = vehicle_origin + tripoint( 0, 5, 0 );
+    here.ter_set( wall, ter_id( "t_wall" ) );
+    CHECK( veh_ptr->may_collide_at( wall, false ) );
+
+    const tripoint monster_pos = vehicle_origin + tripoint( -5, 0, 0 );
+    spawn_test_monster( "mon_zombie", monster_pos );
+    CHECK( veh_ptr->may_collide_at( monster_pos, false ) );
+
+    const tripoint other_origin = vehicle_origin + tripoint( 0, -5, 0 );
+    REQUIRE( here.add_vehicle( vproto_id( "bicycle" ), other_origin, 0_degrees, 0, 0 ) != nullptr );
+    CHECK( veh_ptr->may_collide_at( other_origin, false ) );
+}
+
 static void check_wreckage( int zlevel )
 {
     clear_map();